@@ -57,6 +57,8 @@ typedef enum rs2_frame_metadata_value
     RS2_FRAME_METADATA_MANUAL_WHITE_BALANCE                 , /**< Color image white balance. */
     RS2_FRAME_METADATA_POWER_LINE_FREQUENCY                 , /**< Power Line Frequency for anti-flickering Off/50Hz/60Hz/Auto. */
     RS2_FRAME_METADATA_LOW_LIGHT_COMPENSATION               , /**< Color lowlight compensation. Zero corresponds to switched off. */
+    RS2_FRAME_METADATA_KERNEL_FRAME_SEQUENCE                , /**< Sequence number of the frame buffer in the kernel driver, gaps are frames dropped before reaching the library. Integer value */
+    RS2_FRAME_METADATA_DEQUEUE_TIMESTAMP                    , /**< Time the library dequeued the frame from the kernel driver, in system clock. Compare with the backend timestamp for the kernel latency. msec */
     RS2_FRAME_METADATA_COUNT
 } rs2_frame_metadata_value;
 const char* rs2_frame_metadata_to_string(rs2_frame_metadata_value metadata);
@@ -323,6 +325,52 @@ void rs2_synthetic_frame_ready(rs2_source* source, rs2_frame* frame, rs2_error**
 */
 void rs2_pose_frame_get_pose_data(const rs2_frame* frame, rs2_pose* pose, rs2_error** error);
 
+/**
+* When called on Motion frame type, returns the number of samples the frame holds.
+* A motion frame holds more than one sample when RS2_OPTION_MOTION_SAMPLES_BATCHING is enabled on its sensor
+* \param[in] frame       Motion frame
+* \param[out] error      If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return                Number of motion samples in the frame
+*/
+int rs2_motion_frame_get_samples_count(const rs2_frame* frame, rs2_error** error);
+
+/**
+* When called on Motion frame type, returns the data of a single sample, in the format of the frame stream
+* \param[in] frame       Motion frame
+* \param[in] index       Index of the sample, between 0 and rs2_motion_frame_get_samples_count() - 1
+* \param[out] error      If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return                Pointer to the data of the sample, valid as long as the frame is
+*/
+const void* rs2_motion_frame_get_sample_data(const rs2_frame* frame, int index, rs2_error** error);
+
+/**
+* When called on Motion frame type, returns the timestamp of a single sample
+* \param[in] frame       Motion frame
+* \param[in] index       Index of the sample, between 0 and rs2_motion_frame_get_samples_count() - 1
+* \param[out] error      If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return                Timestamp of the sample in milliseconds, in the timestamp domain of the frame
+*/
+rs2_time_t rs2_motion_frame_get_sample_timestamp(const rs2_frame* frame, int index, rs2_error** error);
+
+/**
+* When called on a frame extendable to RS2_EXTENSION_DMABUF_FRAME, returns the DMABUF file descriptor holding the frame data.
+* Frames are exported when RS2_OPTION_DMABUF_EXPORT is enabled on their sensor and require no format conversion.
+* The descriptor is owned by the library and valid only until the frame is released; duplicate it to keep the buffer longer
+* \param[in] frame      handle returned from a callback
+* \param[out] error     if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return               DMABUF file descriptor
+*/
+int rs2_get_frame_dmabuf_fd(const rs2_frame* frame, rs2_error** error);
+
+/**
+* When called on a frame extendable to RS2_EXTENSION_DMABUF_FRAME, returns the offset in bytes of the frame data in its DMABUF.
+* Lines are rs2_get_frame_stride_in_bytes() apart
+* \param[in] frame      handle returned from a callback
+* \param[out] error     if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return               offset of the frame data in bytes
+*/
+int rs2_get_frame_dmabuf_offset(const rs2_frame* frame, rs2_error** error);
+
 
 
 
@@ -64,6 +64,11 @@ typedef enum rs2_option
     RS2_OPTION_STEREO_BASELINE                            , /**< The distance in mm between the first and the second imagers in stereo-based depth cameras*/
     RS2_OPTION_AUTO_EXPOSURE_CONVERGE_STEP                , /**< Allows dynamically ajust the converge step value of the target exposure in Auto-Exposure algorithm*/
     RS2_OPTION_INTER_CAM_SYNC_MODE                        , /**< Impose Inter-camera HW synchronization mode. Applicable for D400/Rolling Shutter SKUs */
+    RS2_OPTION_MOTION_SAMPLES_BATCHING                    , /**< Deliver all the motion samples of a single read as one batched motion frame, with a timestamp per sample */
+    RS2_OPTION_ADAPTIVE_FRAME_BUFFERS                     , /**< Choose the number of kernel frame buffers on stream start from the buffer hold times and frame drops of the previous stream */
+    RS2_OPTION_FRAME_BUFFERS                              , /**< Number of kernel frame buffers the stream was started with */
+    RS2_OPTION_DROPPED_FRAMES                             , /**< Number of frames dropped by the kernel since the stream was started */
+    RS2_OPTION_DMABUF_EXPORT                              , /**< Export the frame buffers of the next stream as DMABUF file descriptors, see RS2_EXTENSION_DMABUF_FRAME */
     RS2_OPTION_COUNT                                        /**< Number of enumeration values. Not a valid input: intended to be used in for-loops. */
 } rs2_option;
 const char* rs2_option_to_string(rs2_option option);
@@ -16,6 +16,7 @@ extern "C" {
 
 #include "rs_types.h"
 #include "rs_sensor.h"
+#include "rs_record_playback.h"
 
     /**
     * Create a pipeline instance
@@ -285,6 +286,45 @@ extern "C" {
     */
     void rs2_config_enable_record_to_file(rs2_config* config, const char* file, rs2_error ** error);
 
+    /**
+    * Requires that the resolved device would be recorded to file, with the given compression
+    * This request cannot be used if enable_device_from_file() is called for the current config, and vise versa
+    *
+    * \param[in] config       A pointer to an instance of a config
+    * \param[in] file         The desired file for the output record
+    * \param[in] compression  Compression of the chunks of the file
+    * \param[in] chunk_size   Size in bytes of the uncompressed data a chunk holds, 0 for the default
+    * \param[in] compression_threads  Number of threads compressing chunks ahead of the file write, 0 for one per hardware thread, up to 4
+    * \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+    */
+    void rs2_config_enable_record_to_file_ex(rs2_config* config, const char* file, rs2_record_compression compression, unsigned int chunk_size, unsigned int compression_threads, rs2_error ** error);
+
+    /**
+    * Persist the resolved pipeline profile to a cache file, keyed by the device serial number and firmware version.
+    * Subsequent resolutions of an identical config use the cached profile when the same device is connected, and skip
+    * the search for a device and streams that satisfy the request.
+    * The cache is not used with enable_device_from_file().
+    *
+    * \param[in] config    A pointer to an instance of a config
+    * \param[in] file      The cache file to read and update
+    * \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+    */
+    void rs2_config_enable_profile_cache(rs2_config* config, const char* file, rs2_error ** error);
+
+    /**
+    * Resolve the config within the USB bandwidth of the devices.
+    * The bandwidth of a profile is estimated as width * height * bytes-per-pixel * fps of its video streams, and the
+    * sample rate of its motion streams. When the requested streams exceed the capacity of the USB bus a device is attached to,
+    * the frame rate of video streams that were requested without a specific frame rate is lowered, starting with the most
+    * demanding device on the bus. A multi-device pipeline sums the bandwidth of all the devices that share a bus.
+    * If no feasible combination exists, resolving fails with an error naming the stream request to downgrade.
+    *
+    * \param[in] config    A pointer to an instance of a config
+    * \param[in] enable    Non-zero to resolve within the USB bandwidth, zero to disable
+    * \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+    */
+    void rs2_config_enable_bandwidth_aware_resolve(rs2_config* config, int enable, rs2_error ** error);
+
 
     /**
     * Disable a device stream explicitly, to remove any requests on this stream type.
@@ -350,6 +390,77 @@ extern "C" {
     */
     int rs2_config_can_resolve(rs2_config* config, rs2_pipeline* pipe, rs2_error ** error);
 
+    /**
+    * Create a multi-device pipeline instance
+    * The multi-device pipeline streams all the connected devices that satisfy a single config. Frames of all the devices
+    * are synchronized on a shared, bounded pool of worker threads, so the number of threads does not grow with the number of devices.
+    * Each device keeps its latest framesets in a queue of its own, and the queues of the devices are served in turn.
+    * \param[in]  ctx    context
+    * \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+    */
+    rs2_multi_pipeline* rs2_create_multi_pipeline(rs2_context* ctx, rs2_error ** error);
+
+    /**
+    * Start streaming every connected device that satisfies the config.
+    * Devices that cannot satisfy the config are skipped. The call fails if no device satisfies it.
+    * Playback and recording are not supported by the multi-device pipeline.
+    * \param[in] pipe    the multi-device pipeline
+    * \param[in] config  A rs2::config with requested filters, applied to each of the devices
+    * \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+    */
+    void rs2_multi_pipeline_start_with_config(rs2_multi_pipeline* pipe, rs2_config* config, rs2_error ** error);
+
+    /**
+    * Stop streaming all the devices of the multi-device pipeline and release them.
+    * \param[in] pipe    the multi-device pipeline
+    * \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+    */
+    void rs2_multi_pipeline_stop(rs2_multi_pipeline* pipe, rs2_error ** error);
+
+    /**
+    * Wait until a new set of frames of any of the devices becomes available.
+    * The returned frameset holds time-synchronized frames of a single device. The device can be identified by matching the
+    * unique id of the frames stream profiles with the streams of the active profiles.
+    * \param[in] pipe          the multi-device pipeline
+    * \param[in] timeout_ms    Max time in milliseconds to wait until an exception will be thrown
+    * \param[out] error        if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+    * \return Set of coherent frames of one device
+    */
+    rs2_frame* rs2_multi_pipeline_wait_for_frames(rs2_multi_pipeline* pipe, unsigned int timeout_ms, rs2_error ** error);
+
+    /**
+    * Check if a new set of frames of any of the devices is available, and retrieve it without blocking.
+    * \param[in] pipe           the multi-device pipeline
+    * \param[out] output_frame  frame handle to be released using rs2_release_frame
+    * \param[out] error         if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+    * \return true if new frame was stored to output_frame
+    */
+    int rs2_multi_pipeline_poll_for_frames(rs2_multi_pipeline* pipe, rs2_frame** output_frame, rs2_error ** error);
+
+    /**
+    * Retrieve the number of devices streamed by the multi-device pipeline.
+    * \param[in] pipe    the multi-device pipeline
+    * \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+    * \return number of active pipeline profiles, one per device
+    */
+    int rs2_multi_pipeline_get_profiles_count(rs2_multi_pipeline* pipe, rs2_error ** error);
+
+    /**
+    * Retrieve the active device and streams profile of one of the devices streamed by the multi-device pipeline.
+    * \param[in] pipe    the multi-device pipeline
+    * \param[in] index   index of the device, between 0 and rs2_multi_pipeline_get_profiles_count - 1
+    * \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+    * \return the pipeline profile of the device, to be deleted using rs2_delete_pipeline_profile
+    */
+    rs2_pipeline_profile* rs2_multi_pipeline_get_active_profile(rs2_multi_pipeline* pipe, int index, rs2_error ** error);
+
+    /**
+    * Delete a multi-device pipeline instance.
+    * Upon destruction, the pipeline will implicitly stop itself
+    * \param[in] pipe to delete
+    */
+    void rs2_delete_multi_pipeline(rs2_multi_pipeline* pipe);
+
 #ifdef __cplusplus
 }
 #endif
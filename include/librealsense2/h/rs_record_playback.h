@@ -26,6 +26,26 @@ typedef enum rs2_playback_status
 } rs2_playback_status;
 const char* rs2_playback_status_to_string(rs2_playback_status status);
 
+/** \brief Compression of the chunks of a recorded file */
+typedef enum rs2_record_compression
+{
+    RS2_RECORD_COMPRESSION_NONE, /**< Chunks are written to the file uncompressed */
+    RS2_RECORD_COMPRESSION_LZ4,  /**< Chunks are compressed with LZ4 on a pool of worker threads, ahead of the file write. This is the default */
+    RS2_RECORD_COMPRESSION_LZ4_RVL_DEPTH, /**< As LZ4, with 16 bit depth and disparity frames encoded losslessly with RVL ahead of the chunk compression */
+    RS2_RECORD_COMPRESSION_COUNT
+} rs2_record_compression;
+const char* rs2_record_compression_to_string(rs2_record_compression compression);
+
+/** \brief What a recorder does with a frame that does not fit in its write buffer */
+typedef enum rs2_record_overflow_policy
+{
+    RS2_RECORD_OVERFLOW_STOP,  /**< The recording of the sensor of the frame stops with an error notification, the sensor keeps streaming. This is the default */
+    RS2_RECORD_OVERFLOW_DROP,  /**< The frame is dropped and counted in the statistics of its stream, the recording goes on */
+    RS2_RECORD_OVERFLOW_BLOCK, /**< The sensor callback waits until the buffered frames are written to make room for the frame */
+    RS2_RECORD_OVERFLOW_COUNT
+} rs2_record_overflow_policy;
+const char* rs2_record_overflow_policy_to_string(rs2_record_overflow_policy policy);
+
 typedef void (*rs2_playback_status_changed_callback_ptr)(rs2_playback_status);
 
 /**
@@ -37,6 +57,18 @@ typedef void (*rs2_playback_status_changed_callback_ptr)(rs2_playback_status);
  */
 rs2_device* rs2_create_record_device(const rs2_device* device, const char* file, rs2_error** error);
 
+/**
+ * Creates a recording device to record the given device and save it to the given file, with the given compression
+ * \param[in]  device       The device to record
+ * \param[in]  file         The desired path to which the recorder should save the data
+ * \param[in]  compression  Compression of the chunks of the file
+ * \param[in]  chunk_size   Size in bytes of the uncompressed data a chunk holds, 0 for the default
+ * \param[in]  compression_threads  Number of threads compressing chunks ahead of the file write, 0 for one per hardware thread, up to 4
+ * \param[out] error        If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+ * \return A pointer to a device that records its data to file, or null in case of failure
+ */
+rs2_device* rs2_create_record_device_ex(const rs2_device* device, const char* file, rs2_record_compression compression, unsigned int chunk_size, unsigned int compression_threads, rs2_error** error);
+
 /**
 * Pause the recording device without stopping the actual device from streaming.
 * Pausing will cause the device to stop writing new data to the file, in particular, frames and changes to extensions
@@ -52,6 +84,17 @@ void rs2_record_device_pause(const rs2_device* device, rs2_error** error);
 */
 void rs2_record_device_resume(const rs2_device* device, rs2_error** error);
 
+/**
+* Splits the recording into several files, each starting with the description of the device and its streams so that it plays on its own.
+* A new file is started once the current one reaches either limit, without dropping frames. Files after the first one are named after it,
+* with the number of the file appended (e.g. record_1.bag, record_2.bag)
+* \param[in]  device        A recording device
+* \param[in]  max_bytes     Size in bytes of a file, reached at the end of a chunk, 0 for no limit
+* \param[in]  max_duration  Duration in nanoseconds of the recording in a file, 0 for no limit
+* \param[out] error         If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_record_device_set_rotation(const rs2_device* device, unsigned long long max_bytes, long long int max_duration, rs2_error** error);
+
 /**
 * Gets the name of the file to which the recorder is writing
 * \param[in]  device    A recording device
@@ -60,6 +103,33 @@ void rs2_record_device_resume(const rs2_device* device, rs2_error** error);
 */
 const char* rs2_record_device_filename(const rs2_device* device, rs2_error** error);
 
+/**
+* Sets the write buffer of the recording device, which holds the frames raised by the sensors until they are written to the file.
+* A frame is always accepted when the buffer is empty, even if larger than the buffer
+* \param[in]  device     A recording device
+* \param[in]  max_bytes  Size in bytes of the frames the buffer holds, 0 for the default (about one second of 1080p RGBA at 30 FPS)
+* \param[in]  policy     What to do with a frame that does not fit in the buffer
+* \param[out] error      If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_record_device_set_write_buffer(const rs2_device* device, unsigned long long max_bytes, rs2_record_overflow_policy policy, rs2_error** error);
+
+/**
+* Gets the number of frames of a stream that were dropped since the recording started, because they did not fit in the write buffer
+* \param[in]  device   A recording device
+* \param[in]  profile  A stream profile of one of the sensors of the device, identifying the stream by its type and index
+* \param[out] error    If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return The number of dropped frames of the stream
+*/
+unsigned long long rs2_record_device_get_dropped_frames(const rs2_device* device, const rs2_stream_profile* profile, rs2_error** error);
+
+/**
+* Gets the size of the frames waiting in the write buffer of the recording device
+* \param[in]  device   A recording device
+* \param[out] error    If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return Size in bytes of the buffered frames
+*/
+unsigned long long rs2_record_device_get_buffered_bytes(const rs2_device* device, rs2_error** error);
+
 /**
 * Creates a playback device to play the content of the given file
 * \param[in]  file      Path to the file to play
@@ -139,6 +209,73 @@ void rs2_playback_device_set_real_time(const rs2_device* device, int real_time,
  */
 int rs2_playback_device_is_real_time(const rs2_device* device, rs2_error** error);
 
+/**
+ * Set how much data the playback reads ahead of the frames it delivers
+ *
+ * Data is read, decompressed and deserialized from the file on a separate thread, up to max_frames
+ * frames and max_bytes bytes of frame data ahead of playback, so that slow storage does not delay frames.
+ * Seeking or stopping the playback drops the data that was read ahead.
+ * \param[in] device     A playback device
+ * \param[in] max_frames Maximum number of frames read ahead (at most 16), 0 disables reading ahead
+ * \param[in] max_bytes  Maximum size in bytes of the frames read ahead, at least one frame is always read ahead
+ * \param[out] error     If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+ */
+void rs2_playback_device_set_read_ahead(const rs2_device* device, unsigned int max_frames, unsigned long long max_bytes, rs2_error** error);
+
+/**
+ * Returns the number of frames of a stream in the playback file
+ * \param[in] device     A playback device
+ * \param[in] profile    One of the stream profiles of the playback device
+ * \param[out] error     If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+ * \return Number of frames of the stream
+ */
+unsigned long long rs2_playback_get_frame_count(const rs2_device* device, const rs2_stream_profile* profile, rs2_error** error);
+
+/**
+ * Reads a frame of a stream from the playback file by its position, regardless of the playback status
+ *
+ * The frame is read directly from the file, without moving the playback or waiting for it.
+ * Several threads may read frames concurrently, each through a file cursor of its own.
+ * \param[in] device     A playback device
+ * \param[in] profile    One of the stream profiles of the playback device
+ * \param[in] position   Position of the frame in the stream, from 0 to the frame count of the stream
+ * \param[out] error     If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+ * \return The frame, which should be released by rs2_release_frame
+ */
+rs2_frame* rs2_playback_get_frame(const rs2_device* device, const rs2_stream_profile* profile, unsigned long long position, rs2_error** error);
+
+/**
+ * Returns the time at which a frame of a stream was recorded
+ * \param[in] device     A playback device
+ * \param[in] profile    One of the stream profiles of the playback device
+ * \param[in] position   Position of the frame in the stream, from 0 to the frame count of the stream
+ * \param[out] error     If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+ * \return Time in nanoseconds from the beginning of the file, as for rs2_playback_seek
+ */
+long long int rs2_playback_get_frame_time(const rs2_device* device, const rs2_stream_profile* profile, unsigned long long position, rs2_error** error);
+
+/**
+ * Returns the position of the first frame of a stream recorded at or after a time
+ * \param[in] device     A playback device
+ * \param[in] profile    One of the stream profiles of the playback device
+ * \param[in] time       Time in nanoseconds from the beginning of the file, as for rs2_playback_seek
+ * \param[out] error     If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+ * \return Position of the frame, or the frame count of the stream when no frame was recorded at or after this time
+ */
+unsigned long long rs2_playback_find_frame(const rs2_device* device, const rs2_stream_profile* profile, long long int time, rs2_error** error);
+
+/**
+ * Returns the position of the first frame of a stream with a given frame number
+ *
+ * Frame numbers are read from the file on the first call for a stream.
+ * \param[in] device       A playback device
+ * \param[in] profile      One of the stream profiles of the playback device
+ * \param[in] frame_number Frame number, as returned by rs2_get_frame_number
+ * \param[out] error       If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+ * \return Position of the frame, or the frame count of the stream when there is no such frame
+ */
+unsigned long long rs2_playback_find_frame_number(const rs2_device* device, const rs2_stream_profile* profile, unsigned long long frame_number, rs2_error** error);
+
 /**
  * Register to receive callback from playback device upon its status changes
  *
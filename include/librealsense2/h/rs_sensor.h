@@ -304,6 +304,16 @@ const char* rs2_get_notification_serialized_data(rs2_notification* notification,
 */
 rs2_stream_profile_list* rs2_get_stream_profiles(rs2_sensor* device, rs2_error** error);
 
+/**
+* Retrieve the runtime statistics of a stream of the sensor, accumulated since the sensor was last opened
+* \param[in] sensor      the RealSense sensor
+* \param[in] stream      the stream type
+* \param[in] index       the stream index
+* \param[out] statistics the counters and latency histograms of the stream
+* \param[out] error      if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_get_stream_statistics(const rs2_sensor* sensor, rs2_stream stream, int index, rs2_stream_statistics* statistics, rs2_error** error);
+
 /**
 * Get pointer to specific stream profile
 * \param[in] list        the list of supported profiles returned by rs2_get_supported_profiles
@@ -78,6 +78,30 @@ typedef struct rs2_motion_device_intrinsic
     float bias_variances[3];   /**< Variance of bias for X, Y, and Z axis */
 } rs2_motion_device_intrinsic;
 
+#define RS2_LATENCY_HISTOGRAM_BINS 16
+
+/** \brief Distribution of a latency. Bin 0 counts the samples under 0.125 ms, bin i the samples in [0.125 * 2^(i-1), 0.125 * 2^i) ms,
+    and the last bin all the longer samples */
+typedef struct rs2_latency_histogram
+{
+    unsigned long long bins[RS2_LATENCY_HISTOGRAM_BINS]; /**< Number of samples in each bin */
+    unsigned long long count;                            /**< Total number of samples */
+    double             mean;                             /**< Mean latency in milliseconds */
+    double             max;                              /**< Longest latency in milliseconds */
+} rs2_latency_histogram;
+
+/** \brief Runtime statistics of a stream of a sensor, since the sensor was last opened */
+typedef struct rs2_stream_statistics
+{
+    unsigned long long    frames_received;      /**< Frames delivered by the backend */
+    unsigned long long    kernel_drops;         /**< Frames missing in the kernel frame sequence numbers */
+    unsigned long long    publish_failures;     /**< Frames dropped because the application held frame_queue_size frames of the stream */
+    unsigned long long    queue_overflows;      /**< Frames evicted from full frame queues before they were dequeued */
+    rs2_latency_histogram kernel_to_dequeue;    /**< Time from the kernel completing the frame to the backend dequeuing it, when reported by the backend */
+    rs2_latency_histogram dequeue_to_callback;  /**< Time from the backend dequeuing the frame to the frame callback, when reported by the backend */
+    rs2_latency_histogram callback_duration;    /**< Time spent in the frame callback */
+} rs2_stream_statistics;
+
 /** \brief Severity of the librealsense logger */
 typedef enum rs2_log_severity {
     RS2_LOG_SEVERITY_DEBUG, /**< Detailed information about ordinary operations */
@@ -118,6 +142,7 @@ typedef enum rs2_extension
     RS2_EXTENSION_TM2,
     RS2_EXTENSION_SOFTWARE_DEVICE,
     RS2_EXTENSION_SOFTWARE_SENSOR,
+    RS2_EXTENSION_DMABUF_FRAME,
     RS2_EXTENSION_COUNT
 } rs2_extension;
 const char* rs2_extension_type_to_string(rs2_extension type);
@@ -152,6 +177,7 @@ typedef struct rs2_frame rs2_frame;
 typedef struct rs2_frame_queue rs2_frame_queue;
 typedef struct rs2_pipeline rs2_pipeline;
 typedef struct rs2_pipeline_profile rs2_pipeline_profile;
+typedef struct rs2_multi_pipeline rs2_multi_pipeline;
 typedef struct rs2_config rs2_config;
 typedef struct rs2_device_list rs2_device_list;
 typedef struct rs2_stream_profile_list rs2_stream_profile_list;
@@ -95,6 +95,7 @@ namespace rs2
     };
 
     class pipeline;
+    class multi_pipeline;
     class device_hub;
 
     /**
@@ -209,6 +210,7 @@ namespace rs2
 
 protected:
         friend class rs2::pipeline;
+        friend class rs2::multi_pipeline;
         friend class rs2::device_hub;
 
         context(std::shared_ptr<rs2_context> ctx)
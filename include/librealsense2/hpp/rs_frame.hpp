@@ -753,6 +753,55 @@ namespace rs2
         }
     };
 
+    class dmabuf_frame : public video_frame
+    {
+    public:
+        /**
+        * Video frame whose data is held in an exported DMABUF, see RS2_OPTION_DMABUF_EXPORT
+        * \param[in] frame - existing frame instance
+        */
+        dmabuf_frame(const frame& f)
+            : video_frame(f)
+        {
+            rs2_error* e = nullptr;
+            if (!f || (rs2_is_frame_extendable_to(f.get(), RS2_EXTENSION_DMABUF_FRAME, &e) == 0 && !e))
+            {
+                reset();
+            }
+            error::handle(e);
+        }
+
+        /**
+        * Retrieve the DMABUF file descriptor of the frame, valid until the frame is released
+        * \return int - file descriptor
+        */
+        int get_fd() const
+        {
+            rs2_error* e = nullptr;
+            auto r = rs2_get_frame_dmabuf_fd(get(), &e);
+            error::handle(e);
+            return r;
+        }
+
+        /**
+        * Retrieve the offset of the frame data in the DMABUF
+        * \return int - offset in bytes
+        */
+        int get_offset() const
+        {
+            rs2_error* e = nullptr;
+            auto r = rs2_get_frame_dmabuf_offset(get(), &e);
+            error::handle(e);
+            return r;
+        }
+
+        /**
+        * Retrieve the distance between the starts of two lines in the DMABUF
+        * \return int - stride in bytes
+        */
+        int get_stride() const { return get_stride_in_bytes(); }
+    };
+
     class motion_frame : public frame
     {
     public:
@@ -779,6 +828,45 @@ namespace rs2
             auto data = reinterpret_cast<const float*>(get_data());
             return rs2_vector{data[0], data[1], data[2]};
         }
+
+        /**
+        * Retrieve the number of samples the frame holds, more than one when motion samples batching is enabled
+        * \return size_t - number of samples
+        */
+        size_t get_samples_count() const
+        {
+            rs2_error* e = nullptr;
+            auto r = rs2_motion_frame_get_samples_count(get(), &e);
+            error::handle(e);
+            return static_cast<size_t>(r);
+        }
+
+        /**
+        * Retrieve the motion data of a single sample of the frame
+        * \param[in] index - index of the sample, lower than get_samples_count()
+        * \return rs2_vector - 3D vector in Euclidean coordinate space.
+        */
+        rs2_vector get_motion_data(size_t index) const
+        {
+            rs2_error* e = nullptr;
+            auto r = rs2_motion_frame_get_sample_data(get(), static_cast<int>(index), &e);
+            error::handle(e);
+            auto data = reinterpret_cast<const float*>(r);
+            return rs2_vector{data[0], data[1], data[2]};
+        }
+
+        /**
+        * Retrieve the timestamp of a single sample of the frame
+        * \param[in] index - index of the sample, lower than get_samples_count()
+        * \return double - timestamp of the sample in milliseconds
+        */
+        double get_sample_timestamp(size_t index) const
+        {
+            rs2_error* e = nullptr;
+            auto r = rs2_motion_frame_get_sample_timestamp(get(), static_cast<int>(index), &e);
+            error::handle(e);
+            return r;
+        }
     };
 
     class pose_frame : public frame
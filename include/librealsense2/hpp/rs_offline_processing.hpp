@@ -0,0 +1,217 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2017 Intel Corporation. All Rights Reserved.
+
+#ifndef LIBREALSENSE_RS2_OFFLINE_PROCESSING_HPP
+#define LIBREALSENSE_RS2_OFFLINE_PROCESSING_HPP
+
+#include "rs_types.hpp"
+#include "rs_frame.hpp"
+#include "rs_processing.hpp"
+#include "rs_record_playback.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace rs2
+{
+    /**
+    * Processes a recording as fast as the machine allows, rather than at the rate it was recorded.
+    * The file is split into segments of time, each processed on a thread of its own through a processing graph made
+    * for it, and the outputs are delivered in the order of the recording. Frames are read by random access
+    * (see playback::get_frame), so the playback itself is neither started nor moved.
+    *
+    * Each frame of the first stream is processed together with the latest frame of every other stream recorded at or
+    * before it, as a frameset when there are several streams.
+    */
+    class offline_processor
+    {
+    public:
+        // A processing graph: from an input frame (or frameset) to its output, an empty frame to output nothing
+        typedef std::function<frame(frame)> graph;
+
+        /**
+        * \param[in] file      The recording to process
+        * \param[in] streams   Stream profiles of the playback sensors to process, the first one paces the processing
+        * \param[in] segment   Duration of the segments of the recording processed by each thread
+        * \param[in] threads   Number of threads processing segments, 0 for one per core
+        */
+        offline_processor(playback file, std::vector<stream_profile> streams,
+                          std::chrono::nanoseconds segment = std::chrono::seconds(2), unsigned int threads = 0)
+            : _file(file), _streams(streams), _segment(segment), _threads(threads)
+        {
+            if (_streams.empty())
+                throw std::invalid_argument("offline_processor requires at least one stream");
+            if (_segment.count() <= 0)
+                throw std::invalid_argument("offline_processor requires a positive segment duration");
+            if (_threads == 0)
+                _threads = std::max(std::thread::hardware_concurrency(), 1u);
+        }
+
+        /**
+        * Process the whole recording, and return once all the outputs were delivered
+        *
+        * Processing blocks keep state from one frame to the next (the temporal filter, for one), so make_graph is called
+        * on the processing thread at the start of each segment, and the first frames of a segment are processed without
+        * the history of the previous one.
+        * The outputs of a segment are kept until the previous segments are delivered, so the processing blocks of a
+        * graph that expose RS2_OPTION_FRAMES_QUEUE_SIZE should have it set to 0, to not limit the number of frames they output.
+        * At most twice as many segments as threads are kept at a time.
+        * \param[in] make_graph   Makes the processing graph of a segment
+        * \param[in] on_output    Receives the outputs in the order of the recording, on the calling thread
+        */
+        void process(std::function<graph()> make_graph, std::function<void(frame)> on_output) const
+        {
+            auto segments = static_cast<size_t>(_file.get_duration() / _segment) + 1;
+
+            std::mutex mutex;
+            std::condition_variable cv;
+            std::vector<std::vector<frame>> outputs(segments);
+            std::vector<bool> done(segments, false);
+            size_t next = 0;        // Next segment to process
+            size_t delivered = 0;   // Segments delivered so far
+            std::exception_ptr error;
+
+            auto worker = [&]()
+            {
+                while (true)
+                {
+                    size_t segment;
+                    {
+                        std::unique_lock<std::mutex> lock(mutex);
+                        cv.wait(lock, [&]() { return error || next >= segments || next < delivered + 2 * _threads; });
+                        if (error || next >= segments)
+                            return;
+                        segment = next++;
+                    }
+
+                    std::vector<frame> result;
+                    try
+                    {
+                        result = process_segment(segment, make_graph);
+                    }
+                    catch (...)
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        if (!error)
+                            error = std::current_exception();
+                    }
+
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        outputs[segment] = std::move(result);
+                        done[segment] = true;
+                    }
+                    cv.notify_all();
+                }
+            };
+
+            std::vector<std::thread> workers;
+            for (unsigned int i = 0; i < _threads; i++)
+                workers.push_back(std::thread(worker));
+
+            try
+            {
+                for (size_t i = 0; i < segments; i++)
+                {
+                    std::vector<frame> result;
+                    {
+                        std::unique_lock<std::mutex> lock(mutex);
+                        cv.wait(lock, [&]() { return error || done[i]; });
+                        if (error)
+                            break;
+                        result.swap(outputs[i]);
+                        delivered = i + 1;
+                    }
+                    cv.notify_all();
+
+                    for (auto&& f : result)
+                        on_output(f);
+                }
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!error)
+                    error = std::current_exception();
+            }
+
+            cv.notify_all();
+            for (auto&& t : workers)
+                t.join();
+            if (error)
+                std::rethrow_exception(error);
+        }
+
+    private:
+        std::vector<frame> process_segment(size_t segment, const std::function<graph()>& make_graph) const
+        {
+            std::vector<frame> result;
+            auto&& reference = _streams.front();
+            auto begin = _file.find_frame(reference, _segment * segment);
+            auto end = _file.find_frame(reference, _segment * (segment + 1));
+            if (begin == end)
+                return result;
+
+            auto process = make_graph();
+
+            // Frames of several streams are grouped into a frameset, the same way processing blocks output theirs
+            std::vector<frame> group;
+            frame frameset;
+            processing_block combine([&group](frame, const frame_source& source)
+            {
+                source.frame_ready(source.allocate_composite_frame(group));
+            });
+            combine.set_option(RS2_OPTION_FRAMES_QUEUE_SIZE, 0);
+            combine.start([&frameset](frame f) { frameset = f; });
+
+            std::vector<uint64_t> positions(_streams.size(), 0);   // Position after the latest frame read of each stream
+            std::vector<frame> latest(_streams.size());
+            for (auto position = begin; position < end; ++position)
+            {
+                group.clear();
+                group.push_back(_file.get_frame(reference, position));
+                auto time = _file.get_frame_time(reference, position);
+                for (size_t i = 1; i < _streams.size(); i++)
+                {
+                    auto after = _file.find_frame(_streams[i], time + std::chrono::nanoseconds(1));
+                    if (after == 0)
+                        continue;
+                    if (after != positions[i])
+                    {
+                        latest[i] = _file.get_frame(_streams[i], after - 1);
+                        positions[i] = after;
+                    }
+                    group.push_back(latest[i]);
+                }
+
+                auto input = group.front();
+                if (group.size() > 1)
+                {
+                    combine.invoke(group.front());
+                    if (!frameset)
+                        throw std::runtime_error("Error occured during execution of the processing block! See the log for more info");
+                    input = frameset;
+                    frameset = frame();
+                }
+
+                auto output = process(input);
+                if (output)
+                    result.push_back(output);
+            }
+            return result;
+        }
+
+        playback _file;
+        std::vector<stream_profile> _streams;
+        std::chrono::nanoseconds _segment;
+        unsigned int _threads;
+    };
+}
+#endif // LIBREALSENSE_RS2_OFFLINE_PROCESSING_HPP
@@ -111,6 +111,7 @@ namespace rs2
         std::shared_ptr<rs2_pipeline_profile> _pipeline_profile;
         friend class config;
         friend class pipeline;
+        friend class multi_pipeline;
     };
 
     class pipeline;
@@ -242,6 +243,51 @@ namespace rs2
             error::handle(e);
         }
 
+        /**
+        * Requires that the resolved device would be recorded to file, with the given compression
+        * This request cannot be used if enable_device_from_file() is called for the current config, and vise versa
+        *
+        * \param[in] file_name    The desired file for the output record
+        * \param[in] compression  Compression of the chunks of the file
+        * \param[in] chunk_size   Size in bytes of the uncompressed data a chunk holds, 0 for the default
+        * \param[in] compression_threads  Number of threads compressing chunks ahead of the file write, 0 for one per hardware thread, up to 4
+        */
+        void enable_record_to_file(const std::string& file_name, rs2_record_compression compression, unsigned int chunk_size = 0, unsigned int compression_threads = 0)
+        {
+            rs2_error* e = nullptr;
+            rs2_config_enable_record_to_file_ex(_config.get(), file_name.c_str(), compression, chunk_size, compression_threads, &e);
+            error::handle(e);
+        }
+
+        /**
+        * Persist the resolved profile to a cache file, keyed by the device serial number and firmware version.
+        * When the same device is connected, resolving an identical config uses the cached profile and skips the search
+        * for a device and streams that satisfy the request.
+        *
+        * \param[in] file_name  The cache file to read and update
+        */
+        void enable_profile_cache(const std::string& file_name)
+        {
+            rs2_error* e = nullptr;
+            rs2_config_enable_profile_cache(_config.get(), file_name.c_str(), &e);
+            error::handle(e);
+        }
+
+        /**
+        * Resolve the config within the USB bandwidth of the devices.
+        * When the requested streams exceed the capacity of the USB bus of a device, the frame rate of video streams that were
+        * requested without a specific frame rate is lowered. A multi_pipeline sums the bandwidth of all the devices that share a bus.
+        * If no feasible combination exists, resolving throws an error naming the stream request to downgrade.
+        *
+        * \param[in] enable  true to resolve within the USB bandwidth, false to disable
+        */
+        void enable_bandwidth_aware_resolve(bool enable = true)
+        {
+            rs2_error* e = nullptr;
+            rs2_config_enable_bandwidth_aware_resolve(_config.get(), enable ? 1 : 0, &e);
+            error::handle(e);
+        }
+
         /**
         * Disable a device stream explicitly, to remove any requests on this stream profile.
         * The stream can still be enabled due to pipeline computer vision module request. This call removes any filter on the
@@ -388,6 +434,10 @@ namespace rs2
         * the platform, the method fails.
         * Available configurations and devices may change between config \c resolve() call and pipeline start, in case devices
         * are connected or disconnected, or another application acquires ownership of a device.
+        * Restarting the pipeline with a configuration identical to the one of the previous start requests the previously
+        * selected streams from the same device, without searching the connected devices again, as long as a device with the same
+        * serial number and firmware version is connected at the same port. The device object itself is created again, so that a
+        * device that was reset or reconnected since \c stop() is not used in its stale state.
         *
         * \param[in] config   A rs2::config with requested filters on the pipeline configuration. By default no filters are applied.
         * \return             The actual pipeline device and streams profile, which was successfully configured to the streaming device.
@@ -409,6 +459,8 @@ namespace rs2
         * The pipeline stops delivering samples to the attached computer vision modules and processing blocks, stops the device
         * streaming and releases the device resources used by the pipeline. It is the application's responsibility to release any
         * frame reference it owns.
+        * The pipeline does not hold the device after it stopped, it only remembers which streams were selected, for a following
+        * \c start() with an identical configuration.
         * The method takes effect only after \c start() was called, otherwise an exception is raised.
         */
         void stop()
@@ -515,5 +567,115 @@ namespace rs2
         std::shared_ptr<rs2_pipeline> _pipeline;
         friend class config;
     };
+
+    /**
+    * The multi-device pipeline streams all the connected devices that satisfy a single config.
+    * Synchronization of all the devices runs on a shared, bounded pool of worker threads, so the number of threads does not
+    * grow with the number of cameras. Each device produces its own framesets, which the application consumes from a single
+    * \c wait_for_frames() or \c poll_for_frames() call. Each device keeps its latest framesets in a queue of its own, and the
+    * queues are served in turn, so that a faster device does not crowd out a slower one.
+    */
+    class multi_pipeline
+    {
+    public:
+        multi_pipeline(context ctx = context())
+            : _ctx(ctx)
+        {
+            rs2_error* e = nullptr;
+            _pipeline = std::shared_ptr<rs2_multi_pipeline>(
+                rs2_create_multi_pipeline(ctx._context.get(), &e),
+                rs2_delete_multi_pipeline);
+            error::handle(e);
+        }
+
+        /**
+        * Start streaming every connected device that satisfies the config.
+        * Devices that cannot satisfy the config are skipped. If no device satisfies it, an exception is raised.
+        *
+        * \param[in] config   A rs2::config with requested filters, applied to each of the devices. By default no filters are applied.
+        * \return             The actual device and streams profile of each of the streaming devices.
+        */
+        std::vector<pipeline_profile> start(const config& config = rs2::config())
+        {
+            rs2_error* e = nullptr;
+            rs2_multi_pipeline_start_with_config(_pipeline.get(), config.get().get(), &e);
+            error::handle(e);
+            return get_active_profiles();
+        }
+
+        /**
+        * Stop streaming all the devices and release them.
+        */
+        void stop()
+        {
+            rs2_error* e = nullptr;
+            rs2_multi_pipeline_stop(_pipeline.get(), &e);
+            error::handle(e);
+        }
+
+        /**
+        * Wait until a new set of frames of any of the devices becomes available.
+        * The returned frameset holds time-synchronized frames of a single device. The device can be identified by matching
+        * the unique id of the frames stream profiles with the streams of \c get_active_profiles().
+        *
+        * \param[in] timeout_ms   Max time in milliseconds to wait until an exception will be thrown
+        * \return                 Set of time synchronized frames of one device
+        */
+        frameset wait_for_frames(unsigned int timeout_ms = 5000) const
+        {
+            rs2_error* e = nullptr;
+            frame f(rs2_multi_pipeline_wait_for_frames(_pipeline.get(), timeout_ms, &e));
+            error::handle(e);
+
+            return frameset(f);
+        }
+
+        /**
+        * Check if a new set of frames of any of the devices is available, and retrieve it without blocking.
+        *
+        * \param[out] f     Frames set handle
+        * \return           True if new set of time synchronized frames was stored to f
+        */
+        bool poll_for_frames(frameset* f) const
+        {
+            if (!f)
+            {
+                throw std::invalid_argument("null frameset");
+            }
+            rs2_error* e = nullptr;
+            rs2_frame* frame_ref = nullptr;
+            auto res = rs2_multi_pipeline_poll_for_frames(_pipeline.get(), &frame_ref, &e);
+            error::handle(e);
+
+            if (res) *f = frameset(frame(frame_ref));
+            return res > 0;
+        }
+
+        /**
+        * Return the active device and streams profile of each of the streaming devices.
+        * The method returns a valid result only between calls to \c start() and \c stop().
+        */
+        std::vector<pipeline_profile> get_active_profiles() const
+        {
+            rs2_error* e = nullptr;
+            auto count = rs2_multi_pipeline_get_profiles_count(_pipeline.get(), &e);
+            error::handle(e);
+
+            std::vector<pipeline_profile> profiles;
+            for (int i = 0; i < count; i++)
+            {
+                auto p = std::shared_ptr<rs2_pipeline_profile>(
+                    rs2_multi_pipeline_get_active_profile(_pipeline.get(), i, &e),
+                    rs2_delete_pipeline_profile);
+                error::handle(e);
+                profiles.push_back(pipeline_profile(p));
+            }
+            return profiles;
+        }
+
+    private:
+        context _ctx;
+        std::shared_ptr<rs2_multi_pipeline> _pipeline;
+    };
 }
 #endif // LIBREALSENSE_RS2_PROCESSING_HPP
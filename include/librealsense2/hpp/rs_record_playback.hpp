@@ -126,6 +126,91 @@ namespace rs2
             error::handle(e);
         }
 
+        /**
+        * Set how much data the playback reads ahead of the frames it delivers, on a separate thread
+        * \param[in] max_frames Maximum number of frames read ahead (at most 16), 0 disables reading ahead
+        * \param[in] max_bytes  Maximum size in bytes of the frames read ahead
+        */
+        void set_read_ahead(unsigned int max_frames, unsigned long long max_bytes) const
+        {
+            rs2_error* e = nullptr;
+            rs2_playback_device_set_read_ahead(_dev.get(), max_frames, max_bytes, &e);
+            error::handle(e);
+        }
+
+        /**
+        * Number of frames of a stream in the file
+        * \param[in] profile  One of the stream profiles of the playback sensors
+        */
+        uint64_t get_frame_count(const stream_profile& profile) const
+        {
+            rs2_error* e = nullptr;
+            auto count = rs2_playback_get_frame_count(_dev.get(), profile.get(), &e);
+            error::handle(e);
+            return count;
+        }
+
+        /**
+        * Read a frame of a stream by its position in the file, without moving or waiting for the playback.
+        * Safe to call from several threads concurrently
+        * \param[in] profile   One of the stream profiles of the playback sensors
+        * \param[in] position  Position of the frame, from 0 to get_frame_count(profile)
+        */
+        frame get_frame(const stream_profile& profile, uint64_t position) const
+        {
+            rs2_error* e = nullptr;
+            auto f = rs2_playback_get_frame(_dev.get(), profile.get(), position, &e);
+            error::handle(e);
+            return frame(f);
+        }
+
+        /**
+        * Time at which a frame of a stream was recorded, in nanoseconds from the beginning of the file
+        */
+        std::chrono::nanoseconds get_frame_time(const stream_profile& profile, uint64_t position) const
+        {
+            rs2_error* e = nullptr;
+            std::chrono::nanoseconds time(rs2_playback_get_frame_time(_dev.get(), profile.get(), position, &e));
+            error::handle(e);
+            return time;
+        }
+
+        /**
+        * Position of the first frame of a stream recorded at or after time, get_frame_count(profile) when there is none
+        */
+        uint64_t find_frame(const stream_profile& profile, std::chrono::nanoseconds time) const
+        {
+            rs2_error* e = nullptr;
+            auto position = rs2_playback_find_frame(_dev.get(), profile.get(), time.count(), &e);
+            error::handle(e);
+            return position;
+        }
+
+        /**
+        * Position of the first frame of a stream with this frame number, get_frame_count(profile) when there is none
+        */
+        uint64_t find_frame_number(const stream_profile& profile, unsigned long long frame_number) const
+        {
+            rs2_error* e = nullptr;
+            auto position = rs2_playback_find_frame_number(_dev.get(), profile.get(), frame_number, &e);
+            error::handle(e);
+            return position;
+        }
+
+        /**
+        * Read the frames of a stream recorded in the time range [from, to], in nanoseconds from the beginning of the file
+        */
+        std::vector<frame> get_frames(const stream_profile& profile, std::chrono::nanoseconds from, std::chrono::nanoseconds to) const
+        {
+            std::vector<frame> frames;
+            auto end = find_frame(profile, to + std::chrono::nanoseconds(1));
+            for (auto position = find_frame(profile, from); position < end; ++position)
+            {
+                frames.push_back(get_frame(profile, position));
+            }
+            return frames;
+        }
+
         /**
         * Set the playing speed
         * \param[in] speed  Indicates a multiplication of the speed to play (e.g: 1 = normal, 0.5 twice as slow)
@@ -219,6 +304,23 @@ namespace rs2
             rs2::error::handle(e);
         }
 
+        /**
+        * Creates a recording device to record the given device and save it to the given file as rosbag format, with the given compression
+        * \param[in]  file         The desired path to which the recorder should save the data
+        * \param[in]  device       The device to record
+        * \param[in]  compression  Compression of the chunks of the file
+        * \param[in]  chunk_size   Size in bytes of the uncompressed data a chunk holds, 0 for the default
+        * \param[in]  compression_threads  Number of threads compressing chunks ahead of the file write, 0 for one per hardware thread, up to 4
+        */
+        recorder(const std::string& file, rs2::device device, rs2_record_compression compression, unsigned int chunk_size = 0, unsigned int compression_threads = 0)
+        {
+            rs2_error* e = nullptr;
+            _dev = std::shared_ptr<rs2_device>(
+                rs2_create_record_device_ex(device.get().get(), file.c_str(), compression, chunk_size, compression_threads, &e),
+                rs2_delete_device);
+            rs2::error::handle(e);
+        }
+
         /**
         * Pause the recording device without stopping the actual device from streaming.
         */
@@ -239,6 +341,56 @@ namespace rs2
             error::handle(e);
         }
 
+        /**
+        * Splits the recording into files that each play on their own, starting a new one once the current file reaches either limit.
+        * Files after the first one are named after it, with the number of the file appended (e.g. record_1.bag, record_2.bag)
+        * \param[in]  max_bytes     Size in bytes of a file, reached at the end of a chunk, 0 for no limit
+        * \param[in]  max_duration  Duration of the recording in a file, 0 for no limit
+        */
+        void set_rotation(unsigned long long max_bytes, std::chrono::nanoseconds max_duration = std::chrono::nanoseconds(0))
+        {
+            rs2_error* e = nullptr;
+            rs2_record_device_set_rotation(_dev.get(), max_bytes, max_duration.count(), &e);
+            error::handle(e);
+        }
+
+        /**
+        * Sets the write buffer, which holds the frames raised by the sensors until they are written to the file
+        * \param[in]  max_bytes  Size in bytes of the frames the buffer holds, 0 for the default
+        * \param[in]  policy     What to do with a frame that does not fit in the buffer: stop recording its sensor, drop it, or make the sensor callback wait
+        */
+        void set_write_buffer(unsigned long long max_bytes, rs2_record_overflow_policy policy = RS2_RECORD_OVERFLOW_STOP)
+        {
+            rs2_error* e = nullptr;
+            rs2_record_device_set_write_buffer(_dev.get(), max_bytes, policy, &e);
+            error::handle(e);
+        }
+
+        /**
+        * Gets the number of frames of a stream that were dropped because they did not fit in the write buffer
+        * \param[in]  profile  A stream profile of the stream, identified by its type and index
+        * \return The number of dropped frames of the stream since the recording started
+        */
+        unsigned long long get_dropped_frames(const stream_profile& profile) const
+        {
+            rs2_error* e = nullptr;
+            auto dropped = rs2_record_device_get_dropped_frames(_dev.get(), profile.get(), &e);
+            error::handle(e);
+            return dropped;
+        }
+
+        /**
+        * Gets the size of the frames waiting in the write buffer
+        * \return Size in bytes of the buffered frames
+        */
+        unsigned long long get_buffered_bytes() const
+        {
+            rs2_error* e = nullptr;
+            auto bytes = rs2_record_device_get_buffered_bytes(_dev.get(), &e);
+            error::handle(e);
+            return bytes;
+        }
+
         /**
         * Gets the name of the file to which the recorder is writing
         * \return The  name of the file to which the recorder is writing
@@ -370,6 +370,21 @@ namespace rs2
             return results;
         }
 
+        /**
+        * retrieve the runtime statistics of a stream of the sensor, accumulated since the sensor was last opened
+        * \param[in] stream    the stream type
+        * \param[in] index     the stream index
+        * \return              counters and latency histograms of the stream
+        */
+        rs2_stream_statistics get_stream_statistics(rs2_stream stream, int index = 0) const
+        {
+            rs2_stream_statistics statistics{};
+            rs2_error* e = nullptr;
+            rs2_get_stream_statistics(_sensor.get(), stream, index, &statistics, &e);
+            error::handle(e);
+            return statistics;
+        }
+
         sensor& operator=(const std::shared_ptr<rs2_sensor> other)
         {
             options::operator=(other);
@@ -34,6 +34,11 @@ namespace librealsense
         rs2_time_t      backend_timestamp = 0;
         rs2_time_t last_timestamp = 0;
         unsigned long long last_frame_number = 0;
+        uint32_t        motion_samples_count = 0; // Number of samples of a batched motion frame, 0 for a single sample frame
+        int             dmabuf_fd = -1;           // DMABUF holding the frame data when the backend exports its buffers, otherwise -1
+        uint32_t        dmabuf_offset = 0;        // Offset of the frame data in the DMABUF
+        uint32_t        kernel_sequence = 0;      // Sequence number of the kernel frame buffer
+        rs2_time_t      dequeue_time = 0;         // System time the backend dequeued the frame at, 0 when the backend does not report it
 
         frame_additional_data() {};
 
@@ -119,6 +124,7 @@ namespace librealsense
         rs2_metadata_type get_frame_metadata(const rs2_frame_metadata_value& frame_metadata) const override;
         bool supports_frame_metadata(const rs2_frame_metadata_value& frame_metadata) const override;
         const byte* get_frame_data() const override;
+        uint64_t get_frame_data_size() const override { return data.size(); }
         rs2_time_t get_frame_timestamp() const override;
         rs2_timestamp_domain get_frame_timestamp_domain() const override;
         void set_timestamp(double new_ts) override { additional_data.timestamp = new_ts; }
@@ -223,6 +229,15 @@ namespace librealsense
         {
             return first()->get_frame_data();
         }
+        // Unlike the data itself, the size covers all the embedded frames, so that a composite frame is accounted for in full
+        uint64_t get_frame_data_size() const override
+        {
+            uint64_t size = 0;
+            auto frames = get_frames();
+            for (size_t i = 0; i < get_embedded_frames_count(); i++)
+                if (frames[i]) size += frames[i]->get_frame_data_size();
+            return size;
+        }
         rs2_time_t get_frame_timestamp() const override
         {
             return first()->get_frame_timestamp();
@@ -262,6 +277,10 @@ namespace librealsense
         int get_stride() const { return _stride; }
         int get_bpp() const { return _bpp; }
 
+        // Valid while the frame references the exported kernel buffer, that is until the frame is released
+        int get_dmabuf_fd() const { return additional_data.dmabuf_fd; }
+        uint32_t get_dmabuf_offset() const { return additional_data.dmabuf_offset; }
+
         void assign(int width, int height, int stride, int bpp)
         {
             _width = width;
@@ -450,6 +469,61 @@ namespace librealsense
     public:
         motion_frame() : frame()
         {}
+
+        // A batched motion frame holds the unpacked samples of a single HID read, each taking the same number of bytes,
+        // followed by the timestamp of every sample. The frame timestamp is the timestamp of the first sample.
+        uint32_t get_samples_count() const
+        {
+            return additional_data.motion_samples_count ? additional_data.motion_samples_count : 1;
+        }
+
+        const byte* get_sample_data(uint32_t index) const
+        {
+            validate_sample_index(index);
+            return get_frame_data() + index * get_sample_size();
+        }
+
+        rs2_time_t get_sample_timestamp(uint32_t index) const
+        {
+            validate_sample_index(index);
+            if (!additional_data.motion_samples_count)
+                return get_frame_timestamp();
+
+            auto timestamps = reinterpret_cast<const rs2_time_t*>(get_frame_data() + get_samples_count() * get_sample_size());
+            return timestamps[index];
+        }
+
+        // Every sample of a batch is numbered by the sensor, the frame number is that of the first one
+        unsigned long long get_sample_frame_number(uint32_t index) const
+        {
+            validate_sample_index(index);
+            if (!additional_data.motion_samples_count)
+                return get_frame_number();
+
+            auto frame_numbers = reinterpret_cast<const unsigned long long*>(get_frame_data() + get_samples_count() * (get_sample_size() + sizeof(rs2_time_t)));
+            return frame_numbers[index];
+        }
+
+        // Samples, then the timestamp of every sample, then the frame number of every sample
+        static size_t get_batch_size(uint32_t samples_count, size_t sample_size)
+        {
+            return samples_count * (sample_size + sizeof(rs2_time_t) + sizeof(unsigned long long));
+        }
+
+    private:
+        size_t get_sample_size() const
+        {
+            if (!additional_data.motion_samples_count)
+                return data.size();
+            return data.size() / additional_data.motion_samples_count - sizeof(rs2_time_t) - sizeof(unsigned long long);
+        }
+
+        void validate_sample_index(uint32_t index) const
+        {
+            if (index >= get_samples_count())
+                throw invalid_value_exception(to_string() << "Motion sample index " << index << " is out of range, the frame holds "
+                                              << get_samples_count() << " samples");
+        }
     };
 
     MAP_EXTENSION(RS2_EXTENSION_MOTION_FRAME, librealsense::motion_frame);
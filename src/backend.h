@@ -25,6 +25,8 @@
 const uint16_t MAX_RETRIES                = 100;
 const uint16_t VID_INTEL_CAMERA           = 0x8086;
 const uint8_t  DEFAULT_V4L2_FRAME_BUFFERS = 4;
+const uint8_t  MIN_V4L2_FRAME_BUFFERS     = 2;
+const uint8_t  MAX_V4L2_FRAME_BUFFERS     = 16;
 const uint16_t DELAY_FOR_RETRIES          = 50;
 
 const uint8_t MAX_META_DATA_SIZE          = 0xff; // UVC Metadata total length
@@ -171,11 +173,24 @@ namespace librealsense
             const void *    pixels;
             const void *    metadata;
             rs2_time_t      backend_time;
+            int             dmabuf_fd;      // DMABUF of the frame buffer, valid only when the device exports its buffers
+            uint32_t        sequence;       // Kernel sequence number of the frame, valid only when dequeue_time is set
+            rs2_time_t      dequeue_time;   // System time the backend dequeued the frame at, 0 when not reported
+            uint32_t        dropped_frames; // Frames missing in the kernel sequence numbers right before this one
 
         };
 
         typedef std::function<void(stream_profile, frame_object, std::function<void()>)> frame_callback;
 
+        // Capture statistics of the current (or last) stream of a UVC device
+        struct capture_statistics
+        {
+            uint32_t    buffers = 0;            // Number of kernel buffers the stream was started with
+            uint64_t    frames = 0;             // Number of frames received
+            uint64_t    dropped_frames = 0;     // Number of frames missing in the kernel sequence numbers
+            double      max_hold_time_ms = 0;   // Longest time a buffer was held by the application before being requeued
+        };
+
         // Binary-coded decimal represent the USB specification to which the UVC device complies
         enum usb_spec : uint16_t {
             usb_undefined   = 0,
@@ -393,6 +408,7 @@ namespace librealsense
         };
 
         typedef std::function<void(const sensor_data&)> hid_callback;
+        typedef std::function<void(const std::vector<sensor_data>&)> hid_batch_callback;
 
         class hid_device
         {
@@ -402,6 +418,15 @@ namespace librealsense
             virtual void close() = 0;
             virtual void stop_capture() = 0;
             virtual void start_capture(hid_callback callback) = 0;
+            // Delivers all the samples of a single read of a sensor at once.
+            // Backends that do not read several samples at a time deliver each sample on its own.
+            virtual void start_batch_capture(hid_batch_callback callback)
+            {
+                start_capture([callback](const sensor_data& data)
+                {
+                    callback({ data });
+                });
+            }
             virtual std::vector<hid_sensor> get_sensors() = 0;
             virtual std::vector<uint8_t> get_custom_report_data(const std::string& custom_sensor_name,
                                                                 const std::string& report_name,
@@ -439,6 +464,12 @@ namespace librealsense
             virtual std::string get_device_location() const = 0;
             virtual usb_spec  get_usb_specification() const = 0;
 
+            virtual capture_statistics get_capture_statistics() const { return capture_statistics(); }
+
+            // Export the frame buffers of the next stream as DMABUF file descriptors, when supported
+            virtual bool supports_dmabuf_export() const { return false; }
+            virtual void set_dmabuf_export(bool enable) {}
+
             virtual ~uvc_device() = default;
 
         protected:
@@ -564,6 +595,21 @@ namespace librealsense
                 return _dev->get_usb_specification();
             }
 
+            capture_statistics get_capture_statistics() const override
+            {
+                return _dev->get_capture_statistics();
+            }
+
+            bool supports_dmabuf_export() const override
+            {
+                return _dev->supports_dmabuf_export();
+            }
+
+            void set_dmabuf_export(bool enable) override
+            {
+                _dev->set_dmabuf_export(enable);
+            }
+
             void lock() const override { _dev->lock(); }
             void unlock() const override { _dev->unlock(); }
 
@@ -691,6 +737,11 @@ namespace librealsense
                 _dev.front()->start_capture(callback);
             }
 
+            void start_batch_capture(hid_batch_callback callback) override
+            {
+                _dev.front()->start_batch_capture(callback);
+            }
+
             std::vector<hid_sensor> get_sensors() override
             {
                 return _dev.front()->get_sensors();
@@ -827,6 +878,32 @@ namespace librealsense
                 return _dev.front()->get_usb_specification();
             }
 
+            capture_statistics get_capture_statistics() const override
+            {
+                // The statistics outlive the stream, so the last stream of every pin is reported
+                capture_statistics result;
+                for (auto& dev : _dev)
+                {
+                    auto stats = dev->get_capture_statistics();
+                    result.buffers = std::max(result.buffers, stats.buffers);
+                    result.frames += stats.frames;
+                    result.dropped_frames += stats.dropped_frames;
+                    result.max_hold_time_ms = std::max(result.max_hold_time_ms, stats.max_hold_time_ms);
+                }
+                return result;
+            }
+
+            bool supports_dmabuf_export() const override
+            {
+                return std::all_of(_dev.begin(), _dev.end(), [](const std::shared_ptr<uvc_device>& dev) { return dev->supports_dmabuf_export(); });
+            }
+
+            void set_dmabuf_export(bool enable) override
+            {
+                for (auto& dev : _dev)
+                    dev->set_dmabuf_export(enable);
+            }
+
             void lock() const override
             {
                 std::vector<uvc_device*> locked_dev;
@@ -885,6 +962,9 @@ namespace librealsense
         public:
             virtual void start(device_changed_callback callback) = 0;
             virtual void stop() = 0;
+            // Watchers that keep an up-to-date list of the connected devices while started
+            // return it here, saving the caller a full backend enumeration
+            virtual bool query_devices(backend_device_group& devices) const { return false; }
             virtual ~device_watcher() {};
         };
     }
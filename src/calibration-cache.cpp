@@ -0,0 +1,168 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2015 Intel Corporation. All Rights Reserved.
+
+#include "calibration-cache.h"
+#include "file-utils.h"
+#include "types.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+
+namespace librealsense
+{
+    const uint32_t CALIBRATION_CACHE_MAGIC = 0x43435352; // "RSCC"
+    const uint32_t CALIBRATION_CACHE_VERSION = 1;
+    const uint32_t CALIBRATION_CACHE_MAX_TABLE_SIZE = 1 << 20;
+    const unsigned int CALIBRATION_CACHE_QUEUE_SIZE = 16;
+
+    std::shared_ptr<calibration_cache> calibration_cache::create(const std::string& serial, const std::string& fw_version)
+    {
+        auto dir = getenv("LRS_CALIBRATION_CACHE_DIR");
+        if (!dir || !*dir || serial.empty())
+            return nullptr;
+
+        std::string path = to_string() << dir << "/calibration_" << serial << "_" << fw_version << ".bin";
+        return std::make_shared<calibration_cache>(path);
+    }
+
+    calibration_cache::calibration_cache(std::string path)
+        : _path(std::move(path)), _validation(CALIBRATION_CACHE_QUEUE_SIZE)
+    {
+        load();
+        _validation.start();
+    }
+
+    std::vector<uint8_t> calibration_cache::get(uint32_t table_id, std::function<std::vector<uint8_t>()> read)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mtx);
+            auto it = _tables.find(table_id);
+            if (it != _tables.end())
+            {
+                if (_validated.insert(table_id).second)
+                {
+                    _validation.invoke([this, table_id, read](dispatcher::cancellable_timer t)
+                    {
+                        validate(table_id, read);
+                    });
+                }
+                return it->second;
+            }
+        }
+
+        auto table = read();
+        std::lock_guard<std::mutex> lock(_mtx);
+        _tables[table_id] = table;
+        _validated.insert(table_id);
+        save();
+        return table;
+    }
+
+    bool calibration_cache::flush()
+    {
+        return _validation.flush();
+    }
+
+    void calibration_cache::validate(uint32_t table_id, const std::function<std::vector<uint8_t>()>& read)
+    {
+        try
+        {
+            auto table = read();
+            std::lock_guard<std::mutex> lock(_mtx);
+            if (_tables[table_id] != table)
+            {
+                LOG_WARNING("Calibration table " << table_id << " changed on the device, updated " << _path);
+                _tables[table_id] = table;
+                save();
+            }
+        }
+        catch (const std::exception& ex)
+        {
+            LOG_WARNING("Could not validate cached calibration table " << table_id << ": " << ex.what());
+        }
+    }
+
+    // File layout: magic, version, table count, then per table: id, size, CRC32 of the data, data
+    void calibration_cache::load()
+    {
+        std::ifstream file(_path, std::ios::binary);
+        if (!file)
+            return;
+
+        auto read_u32 = [&file]()
+        {
+            uint32_t value = 0;
+            file.read(reinterpret_cast<char*>(&value), sizeof(value));
+            return value;
+        };
+
+        std::map<uint32_t, std::vector<uint8_t>> tables;
+        if (read_u32() != CALIBRATION_CACHE_MAGIC || read_u32() != CALIBRATION_CACHE_VERSION)
+        {
+            LOG_WARNING("Ignoring calibration cache " << _path << " of an unknown format");
+            return;
+        }
+
+        auto count = read_u32();
+        for (uint32_t i = 0; i < count && file; ++i)
+        {
+            auto id = read_u32();
+            auto size = read_u32();
+            auto crc = read_u32();
+            if (!file || size > CALIBRATION_CACHE_MAX_TABLE_SIZE)
+                break;
+
+            std::vector<uint8_t> table(size);
+            file.read(reinterpret_cast<char*>(table.data()), size);
+            if (!file || calc_crc32(table.data(), table.size()) != crc)
+                break;
+            tables[id] = std::move(table);
+        }
+
+        if (tables.size() != count)
+        {
+            LOG_WARNING("Ignoring corrupted calibration cache " << _path);
+            return;
+        }
+        _tables = std::move(tables);
+    }
+
+    // Called with _mtx held. The file is replaced at once so concurrent processes never read a partial cache
+    void calibration_cache::save() const
+    {
+        auto temp_path = temp_file_path(_path);
+        {
+            std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+            auto write_u32 = [&file](uint32_t value)
+            {
+                file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+            };
+
+            write_u32(CALIBRATION_CACHE_MAGIC);
+            write_u32(CALIBRATION_CACHE_VERSION);
+            write_u32(static_cast<uint32_t>(_tables.size()));
+            for (auto&& kvp : _tables)
+            {
+                write_u32(kvp.first);
+                write_u32(static_cast<uint32_t>(kvp.second.size()));
+                write_u32(calc_crc32(kvp.second.data(), kvp.second.size()));
+                file.write(reinterpret_cast<const char*>(kvp.second.data()), kvp.second.size());
+            }
+
+            if (!file)
+            {
+                LOG_WARNING("Could not write calibration cache " << temp_path);
+                file.close();
+                std::remove(temp_path.c_str());
+                return;
+            }
+        }
+
+        if (!replace_file(temp_path, _path))
+        {
+            LOG_WARNING("Could not replace calibration cache " << _path);
+            std::remove(temp_path.c_str());
+        }
+    }
+}
@@ -0,0 +1,49 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2015 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "concurrency.h"
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace librealsense
+{
+    // Persistent copy of the calibration tables of a device, in a file per serial number and firmware version, so that
+    // the first use of the calibration does not wait for the device.
+    // A cached table is served right away and compared with the device in the background. A table that changed on
+    // the device is rewritten to the cache, and is used from the next time the device is created.
+    // The cache is enabled by pointing LRS_CALIBRATION_CACHE_DIR to a writable directory.
+    class calibration_cache
+    {
+    public:
+        // Loads the cache of the device, returns nullptr when the cache is disabled
+        static std::shared_ptr<calibration_cache> create(const std::string& serial, const std::string& fw_version);
+
+        explicit calibration_cache(std::string path);
+
+        // The cached copy of the table when there is one, otherwise the table read from the device, which is then cached.
+        // table_id is any identifier unique within the device, read is called on a background thread to validate the copy
+        std::vector<uint8_t> get(uint32_t table_id, std::function<std::vector<uint8_t>()> read);
+
+        // Waits for the validations started so far, returns false when they did not finish in time
+        bool flush();
+
+    private:
+        void load();
+        void save() const;
+        void validate(uint32_t table_id, const std::function<std::vector<uint8_t>()>& read);
+
+        std::string _path;
+        mutable std::mutex _mtx;
+        std::map<uint32_t, std::vector<uint8_t>> _tables;
+        std::set<uint32_t> _validated;
+        dispatcher _validation; // Declared last to stop the validations before the members above are destroyed
+    };
+}
@@ -33,17 +33,29 @@ public:
 
     void enqueue(T&& item)
     {
+        enqueue(std::move(item), nullptr);
+    }
+
+    // When the queue is full its oldest item is evicted, and moved to dropped if not null.
+    // Returns whether an item was evicted
+    bool enqueue(T&& item, T* dropped)
+    {
+        bool overflow = false;
         std::unique_lock<std::mutex> lock(mutex);
         if (accepting)
         {
             q.push_back(std::move(item));
             if (q.size() > cap)
             {
+                if (dropped)
+                    *dropped = std::move(q.front());
                 q.pop_front();
+                overflow = true;
             }
         }
         lock.unlock();
         cv.notify_one();
+        return overflow;
     }
 
     bool dequeue(T* item ,unsigned int timeout_ms = 5000)
@@ -11,6 +11,9 @@
 #include <cmath>
 #include <set>
 #include <iostream>
+#include <thread>
+#include <exception>
+#include <functional>
 #include "sensor.h"
 #include "types.h"
 #include "stream.h"
@@ -201,19 +204,36 @@ namespace librealsense
                 {}
 
 
+                // Sensors negotiate and allocate their streams independently of each other,
+                // so they are opened and started concurrently to shorten the time to the first frame.
                 void open()
                 {
+                    std::vector<sensor_interface*> sensors;
+                    std::vector<stream_profiles> requests;
                     for (auto && kvp : _dev_to_profiles) {
-                        auto&& sub = _results.at(kvp.first);
-                        sub->open(kvp.second);
+                        sensors.push_back(_results.at(kvp.first));
+                        requests.push_back(kvp.second);
                     }
+
+                    auto errors = invoke_concurrently(sensors.size(), [&](size_t i)
+                    {
+                        sensors[i]->open(requests[i]);
+                    });
+                    rollback_on_error(errors, [&](size_t i) { sensors[i]->close(); });
                 }
 
                 template<class T>
                 void start(T callback)
                 {
+                    std::vector<sensor_interface*> sensors;
                     for (auto&& sensor : _results)
-                        sensor.second->start(callback);
+                        sensors.push_back(sensor.second);
+
+                    auto errors = invoke_concurrently(sensors.size(), [&](size_t i)
+                    {
+                        sensors[i]->start(callback);
+                    });
+                    rollback_on_error(errors, [&](size_t i) { sensors[i]->stop(); });
                 }
 
                 void stop()
@@ -224,8 +244,16 @@ namespace librealsense
 
                 void close()
                 {
+                    std::vector<sensor_interface*> sensors;
                     for (auto&& sensor : _results)
-                        sensor.second->close();
+                        sensors.push_back(sensor.second);
+
+                    auto errors = invoke_concurrently(sensors.size(), [&](size_t i)
+                    {
+                        sensors[i]->close();
+                    });
+                    for (auto&& e : errors)
+                        if (e) std::rethrow_exception(e);
                 }
                 std::map<index_type, std::shared_ptr<stream_profile_interface>> get_profiles() const
                 {
@@ -239,6 +267,52 @@ namespace librealsense
             private:
                 friend class config;
 
+                // Runs action(0..count-1), each index on its own thread, and returns the exception raised per index
+                static std::vector<std::exception_ptr> invoke_concurrently(size_t count, std::function<void(size_t)> action)
+                {
+                    std::vector<std::exception_ptr> errors(count);
+                    auto safe_action = [&](size_t i)
+                    {
+                        try
+                        {
+                            action(i);
+                        }
+                        catch (...)
+                        {
+                            errors[i] = std::current_exception();
+                        }
+                    };
+
+                    std::vector<std::thread> workers;
+                    for (size_t i = 1; i < count; ++i)
+                        workers.emplace_back(safe_action, i);
+                    if (count > 0)
+                        safe_action(0);
+                    for (auto&& worker : workers)
+                        worker.join();
+
+                    return errors;
+                }
+
+                // If any action failed, undo the ones that succeeded and rethrow the first error
+                static void rollback_on_error(const std::vector<std::exception_ptr>& errors, std::function<void(size_t)> undo)
+                {
+                    auto failed = std::find_if(errors.begin(), errors.end(), [](const std::exception_ptr& e) { return e != nullptr; });
+                    if (failed == errors.end())
+                        return;
+
+                    for (size_t i = 0; i < errors.size(); ++i)
+                    {
+                        if (errors[i]) continue;
+                        try
+                        {
+                            undo(i);
+                        }
+                        catch (...) {}
+                    }
+                    std::rethrow_exception(*failed);
+                }
+
                 std::map<index_type, std::shared_ptr<stream_profile_interface>> _profiles;
                 std::map<index_type, sensor_interface*> _devices;
                 std::map<int, sensor_interface*> _results;
@@ -309,8 +309,9 @@ namespace librealsense
 
     std::vector<std::shared_ptr<device_info>> context::query_devices(int mask) const
     {
-
-        platform::backend_device_group devices(_backend->query_uvc_devices(), _backend->query_usb_devices(), _backend->query_hid_devices());
+        platform::backend_device_group devices;
+        if (!_device_watcher->query_devices(devices))
+            devices = platform::backend_device_group(_backend->query_uvc_devices(), _backend->query_usb_devices(), _backend->query_hid_devices());
 
         return create_devices(devices, _playback_devices, mask);
     }
@@ -207,6 +207,8 @@ namespace librealsense
         void set_all(const preset& p);
 
         std::vector<uint8_t> send_receive(const std::vector<uint8_t>& input) const;
+        // Advanced mode commands write controls through the hw monitor, behind the back of the sensor options
+        void invalidate_option_caches() const;
 
         template<class T>
         void set(const T& strct, EtAdvancedModeRegGroup cmd) const
@@ -216,6 +218,7 @@ namespace librealsense
 
             assert_no_error(ds::fw_cmd::SET_ADV,
                 send_receive(encode_command(ds::fw_cmd::SET_ADV, static_cast<uint32_t>(cmd), 0, 0, 0, data)));
+            invalidate_option_caches();
             std::this_thread::sleep_for(std::chrono::milliseconds(20));
         }
 
@@ -330,6 +330,7 @@ namespace librealsense
             virtual void write_snapshot(const sensor_identifier& sensor_id, const nanoseconds& timestamp, rs2_extension type, const std::shared_ptr<extension_snapshot>& snapshot) = 0;
             virtual void write_notification(const sensor_identifier& stream_id, const nanoseconds& timestamp, const notification& n) = 0;
             virtual const std::string& get_file_name() const = 0;
+            virtual void set_rotation(uint64_t max_bytes, const nanoseconds& max_duration) = 0;
             virtual ~writer() = default;
         };
 
@@ -182,6 +182,15 @@ uvc_sensor& device::get_uvc_sensor(int sub)
     return dynamic_cast<uvc_sensor&>(*_sensors[sub]);
 }
 
+void device::invalidate_option_caches()
+{
+    for (auto&& s : _sensors)
+    {
+        if (auto uvc = dynamic_cast<uvc_sensor*>(s.get()))
+            uvc->invalidate_option_cache();
+    }
+}
+
 size_t device::get_sensors_count() const
 {
     return static_cast<unsigned int>(_sensors.size());
@@ -79,6 +79,8 @@ namespace librealsense
         int assign_sensor(std::shared_ptr<sensor_interface> sensor_base, uint8_t idx);
         void register_stream_to_extrinsic_group(const stream_interface& stream, uint32_t groupd_index);
         uvc_sensor& get_uvc_sensor(int subdevice);
+        // For commands that change the controls of the device behind the back of its options (e.g. a hardware reset)
+        void invalidate_option_caches();
 
         explicit device(std::shared_ptr<context> ctx,
                         const platform::backend_device_group group,
@@ -126,7 +126,23 @@ namespace librealsense
     bool device_hub::is_connected(const device_interface& dev)
     {
         std::unique_lock<std::mutex> lock(_mutex);
-        return dev.is_valid();
+        if (!dev.is_valid())
+            return false;
+
+        // A device that was unplugged may still be valid, it is connected only if it is in the list of connected devices,
+        // which is updated on every change of the devices. Devices are matched by their UVC interfaces
+        auto uvc_devices = dev.get_device_data().uvc_devices;
+        if (uvc_devices.empty())
+            return true;
+
+        return std::any_of(_device_list.begin(), _device_list.end(), [&](const std::shared_ptr<device_info>& info)
+        {
+            auto connected = info->get_device_data().uvc_devices;
+            return std::all_of(uvc_devices.begin(), uvc_devices.end(), [&](const platform::uvc_device_info& uvc)
+            {
+                return std::find(connected.begin(), connected.end(), uvc) != connected.end();
+            });
+        });
     }
 }
 
@@ -49,6 +49,7 @@ namespace librealsense
     {
         send_receive(encode_command(ds::fw_cmd::EN_ADV, enable));
         send_receive(encode_command(ds::fw_cmd::HWRST));
+        invalidate_option_caches();
     }
 
     void ds5_advanced_mode_base::apply_preset(const std::vector<platform::stream_profile>& configuration,
@@ -159,6 +160,7 @@ namespace librealsense
             throw invalid_value_exception(to_string() << "apply_preset(...) failed! Invalid preset! (" << preset << ")");
         }
         set_all(p);
+        invalidate_option_caches();
     }
 
     void ds5_advanced_mode_base::get_depth_control_group(STDepthControlGroup* ptr, int mode) const
@@ -658,6 +660,7 @@ namespace librealsense
         update_structs(json_content, p);
         set_all(p);
         _preset_opt->set(RS2_RS400_VISUAL_PRESET_CUSTOM);
+        invalidate_option_caches();
     }
 
     preset ds5_advanced_mode_base::get_all() const
@@ -758,6 +761,13 @@ namespace librealsense
         return res;
     }
 
+    void ds5_advanced_mode_base::invalidate_option_caches() const
+    {
+        _depth_sensor.invalidate_option_cache();
+        if (*_color_sensor)
+            (*_color_sensor)->invalidate_option_cache();
+    }
+
     uint32_t ds5_advanced_mode_base::pack(uint8_t c0, uint8_t c1, uint8_t c2, uint8_t c3)
     {
         return (c0 << 24) | (c1 << 16) | (c2 << 8) | c3;
@@ -73,6 +73,7 @@ namespace librealsense
     {
         command cmd(ds::HWRST);
         _hw_monitor->send(cmd);
+        invalidate_option_caches();
     }
 
     class ds5_depth_sensor : public uvc_sensor, public video_sensor_interface, public depth_stereo_sensor, public roi_sensor_base
@@ -256,13 +257,21 @@ namespace librealsense
 
     bool ds5_device::is_camera_in_advanced_mode() const
     {
-        command cmd(ds::UAMG);
+        return is_camera_in_advanced_mode(send_advanced_mode_query().get());
+    }
+
+    std::shared_future<std::vector<uint8_t>> ds5_device::send_advanced_mode_query() const
+    {
         assert(_hw_monitor);
-        auto ret = _hw_monitor->send(cmd);
-        if (ret.empty())
+        return _hw_monitor->send_async(command(ds::UAMG));
+    }
+
+    bool ds5_device::is_camera_in_advanced_mode(const std::vector<uint8_t>& result)
+    {
+        if (result.empty())
             throw invalid_value_exception("command result is empty!");
 
-        return (0 != ret.front());
+        return (0 != result.front());
     }
 
     float ds5_device::get_stereo_baseline_mm() const
@@ -274,8 +283,17 @@ namespace librealsense
 
     std::vector<uint8_t> ds5_device::get_raw_calibration_table(ds::calibration_table_id table_id) const
     {
-        command cmd(ds::GETINTCAL, table_id);
-        return _hw_monitor->send(cmd);
+        auto hw_mon = _hw_monitor;
+        auto read = [hw_mon, table_id]()
+        {
+            command cmd(ds::GETINTCAL, table_id);
+            cmd.coalesce = true;
+            return hw_mon->send_async(cmd).get();
+        };
+
+        if (_calibration_cache)
+            return _calibration_cache->get(table_id, read);
+        return read();
     }
 
     std::shared_ptr<uvc_sensor> ds5_device::create_depth_device(std::shared_ptr<context> ctx,
@@ -354,13 +372,21 @@ namespace librealsense
 
         _coefficients_table_raw = [this]() { return get_raw_calibration_table(coefficients_table_id); };
 
+        // The device information is read with back to back commands, and a single GVD
+        command gvd_cmd(GVD);
+        gvd_cmd.coalesce = true;
+        auto gvd_future = _hw_monitor->send_async(gvd_cmd);
+        auto advanced_mode_future = send_advanced_mode_query();
+
         std::string device_name = (rs400_sku_names.end() != rs400_sku_names.find(group.uvc_devices.front().pid)) ? rs400_sku_names.at(group.uvc_devices.front().pid) : "RS4xx";
-        _fw_version = firmware_version(_hw_monitor->get_firmware_version_string(GVD, camera_fw_version_offset));
+        auto gvd = gvd_future.get();
+        _fw_version = firmware_version(hw_monitor::get_firmware_version_string(gvd, camera_fw_version_offset));
         recommended_fw_version = firmware_version("5.9.14.0");
-        auto serial = _hw_monitor->get_module_serial_string(GVD, module_serial_offset);
+        auto serial = hw_monitor::get_module_serial_string(gvd, module_serial_offset);
+        _calibration_cache = calibration_cache::create(serial, _fw_version);
 
         auto& depth_ep = get_depth_sensor();
-        auto advanced_mode = is_camera_in_advanced_mode();
+        auto advanced_mode = is_camera_in_advanced_mode(advanced_mode_future.get());
 
         using namespace platform;
         auto _usb_mode = usb3_type;
@@ -387,7 +413,7 @@ namespace librealsense
         std::string is_camera_locked{ "" };
         if (_fw_version >= firmware_version("5.6.3.0"))
         {
-            auto is_locked = _hw_monitor->is_camera_locked(GVD, is_camera_locked_offset);
+            auto is_locked = hw_monitor::is_camera_locked(gvd, is_camera_locked_offset);
             is_camera_locked = (is_locked) ? "YES" : "NO";
 
 #ifdef HWM_OVER_XU
@@ -406,6 +432,7 @@ namespace librealsense
                 depth_xu,
                 DS5_EXPOSURE,
                 "Depth Exposure (usec)");
+            exposure_option->set_volatile(true);
             depth_ep.register_option(RS2_OPTION_EXPOSURE, exposure_option);
 
             auto enable_auto_exposure = std::make_shared<uvc_xu_option<uint8_t>>(depth_ep,
@@ -428,6 +455,7 @@ namespace librealsense
                     "Generate trigger from the camera to external device once per frame"));
 
             auto error_control = std::unique_ptr<uvc_xu_option<uint8_t>>(new uvc_xu_option<uint8_t>(depth_ep, depth_xu, DS5_ERROR_REPORTING, "Error reporting"));
+            error_control->set_volatile(true);
 
             _polling_error_handler = std::unique_ptr<polling_error_handler>(
                 new polling_error_handler(1000,
@@ -10,6 +10,7 @@
 #include "core/debug.h"
 #include "core/advanced_mode.h"
 #include "device.h"
+#include "calibration-cache.h"
 
 namespace librealsense
 {
@@ -39,6 +40,10 @@ namespace librealsense
         std::vector<uint8_t> get_raw_calibration_table(ds::calibration_table_id table_id) const;
 
         bool is_camera_in_advanced_mode() const;
+        // Queue the advanced mode query, so that it runs back to back with other commands
+        std::shared_future<std::vector<uint8_t>> send_advanced_mode_query() const;
+        // Parse the result of the advanced mode query
+        static bool is_camera_in_advanced_mode(const std::vector<uint8_t>& result);
 
         float get_stereo_baseline_mm() const;
 
@@ -61,6 +66,7 @@ namespace librealsense
 
         std::unique_ptr<polling_error_handler> _polling_error_handler;
         std::shared_ptr<lazy<rs2_extrinsics>> _left_right_extrinsics;
+        std::shared_ptr<calibration_cache> _calibration_cache; // nullptr unless enabled
     };
 
     class ds5u_device : public ds5_device
@@ -158,8 +158,17 @@ namespace librealsense
     {
         const int offset = 0;
         const int size = ds::tm1_eeprom_size;
-        command cmd(ds::MMER, offset, size);
-        return _hw_monitor->send(cmd);
+        auto hw_mon = _hw_monitor;
+        auto read = [hw_mon, offset, size]()
+        {
+            command cmd(ds::MMER, offset, size);
+            cmd.coalesce = true;
+            return hw_mon->send_async(cmd).get();
+        };
+
+        if (_calibration_cache)
+            return _calibration_cache->get(ds::tm1_eeprom_cache_id, read);
+        return read();
     }
 
     ds::tm1_eeprom ds5_motion::get_tm1_eeprom() const
@@ -183,20 +183,25 @@ namespace librealsense
         mm_ep->register_on_before_frame_callback(
                     [this](rs2_stream stream, frame_interface* fr, callback_invocation_holder callback)
         {
-            if (_is_enabled.load() && fr->get_stream()->get_format() == RS2_FORMAT_MOTION_XYZ32F)
+            auto motion = dynamic_cast<motion_frame*>(fr);
+            if (_is_enabled.load() && motion && fr->get_stream()->get_format() == RS2_FORMAT_MOTION_XYZ32F)
             {
-                auto xyz = (float*)(fr->get_frame_data());
-
-                if (stream == RS2_STREAM_ACCEL)
-                {
-                    for (int i = 0; i < 3; i++)
-                        xyz[i] = xyz[i] * _accel.scale[i] - _accel.bias[i];
-                }
-
-                if (stream == RS2_STREAM_GYRO)
+                // Batched motion frames are corrected sample by sample
+                for (uint32_t s = 0; s < motion->get_samples_count(); s++)
                 {
-                    for (int i = 0; i < 3; i++)
-                        xyz[i] = xyz[i] * _gyro.scale[i] - _gyro.bias[i];
+                    auto xyz = (float*)(motion->get_sample_data(s));
+
+                    if (stream == RS2_STREAM_ACCEL)
+                    {
+                        for (int i = 0; i < 3; i++)
+                            xyz[i] = xyz[i] * _accel.scale[i] - _accel.bias[i];
+                    }
+
+                    if (stream == RS2_STREAM_GYRO)
+                    {
+                        for (int i = 0; i < 3; i++)
+                            xyz[i] = xyz[i] * _gyro.scale[i] - _gyro.bias[i];
+                    }
                 }
             }
         });
@@ -288,6 +288,7 @@ namespace librealsense
         };
 
         constexpr size_t tm1_eeprom_size = sizeof(tm1_eeprom);
+        const uint32_t tm1_eeprom_cache_id = 0x10000; // Calibration cache key of the TM1 EEPROM, clear of the calibration_table_id values
 
         struct depth_table_control
         {
@@ -0,0 +1,43 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2015 Intel Corporation. All Rights Reserved.
+
+// Kept apart from types.cpp, windows.h defines macros (ERROR, ...) that clash with the enum names stringified there
+#include "file-utils.h"
+
+#include <sstream>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <process.h>
+#else
+#include <cstdio>
+#include <unistd.h>
+#endif
+
+namespace librealsense
+{
+    std::string temp_file_path(const std::string& path)
+    {
+#ifdef _WIN32
+        auto pid = _getpid();
+#else
+        auto pid = getpid();
+#endif
+        std::stringstream ss;
+        ss << path << "." << pid << ".tmp";
+        return ss.str();
+    }
+
+    bool replace_file(const std::string& temp_path, const std::string& path)
+    {
+#ifdef _WIN32
+        // rename() fails on Windows when the destination exists
+        return MoveFileExA(temp_path.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+        return std::rename(temp_path.c_str(), path.c_str()) == 0;
+#endif
+    }
+}
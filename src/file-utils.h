@@ -0,0 +1,14 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2015 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <string>
+
+namespace librealsense
+{
+    // Path of a file written next to path, unique to the process, to replace path once complete
+    std::string temp_file_path(const std::string& path);
+    // Replaces the file at path by the file at temp_path at once, also when path already exists. Returns false on failure
+    bool replace_file(const std::string& temp_path, const std::string& path);
+}
@@ -40,10 +40,10 @@ namespace librealsense
     }
 
 
-    void hw_monitor::execute_usb_command(uint8_t *out, size_t outSize, uint32_t & op, uint8_t * in, size_t & inSize) const
+    void hw_monitor::execute_usb_command(uint8_t *out, size_t outSize, uint32_t & op, uint8_t * in, size_t & inSize, int timeout_ms) const
     {
         std::vector<uint8_t> out_vec(out, out + outSize);
-        auto res = _locked_transfer->send_receive(out_vec);
+        auto res = _locked_transfer->send_receive(out_vec, timeout_ms);
 
         // read
         if (in && inSize)
@@ -86,7 +86,8 @@ namespace librealsense
         uint32_t op{};
         size_t receivedCmdLen = HW_MONITOR_BUFFER_SIZE;
 
-        execute_usb_command(details.sendCommandData.data(), details.sizeOfSendCommandData, op, outputBuffer, receivedCmdLen);
+        execute_usb_command(details.sendCommandData.data(), details.sizeOfSendCommandData, op, outputBuffer, receivedCmdLen,
+                            static_cast<int>(details.timeOut));
         update_cmd_details(details, receivedCmdLen, outputBuffer);
     }
 
@@ -137,10 +138,77 @@ namespace librealsense
             newCommand.receivedCommandData + newCommand.receivedCommandDataLength);
     }
 
+    std::shared_future<std::vector<uint8_t>> hw_monitor::send_async(command cmd) const
+    {
+        // Identical commands are recognized by the buffer they send to the device
+        std::vector<uint8_t> key;
+        if (cmd.coalesce)
+        {
+            hwmon_cmd newCommand(cmd);
+            std::array<uint8_t, HW_MONITOR_COMMAND_SIZE> buffer;
+            int length = 0;
+            fill_usb_buffer(newCommand.cmd, newCommand.param1, newCommand.param2, newCommand.param3, newCommand.param4,
+                newCommand.data, newCommand.sizeOfSendCommandData, buffer.data(), length);
+            key.assign(buffer.begin(), buffer.begin() + length);
+        }
+
+        auto promise = std::make_shared<std::promise<std::vector<uint8_t>>>();
+        auto result = promise->get_future().share();
+        {
+            std::lock_guard<std::mutex> lock(_queue_mutex);
+            if (cmd.coalesce)
+            {
+                auto it = _in_flight.find(key);
+                if (it != _in_flight.end())
+                    return it->second;
+                _in_flight[key] = result;
+            }
+
+            if (!_dispatcher)
+            {
+                _dispatcher = std::unique_ptr<dispatcher>(new dispatcher(HW_MONITOR_QUEUE_SIZE));
+                _dispatcher->start();
+            }
+
+            if (_pending < HW_MONITOR_QUEUE_SIZE)
+            {
+                ++_pending;
+                _dispatcher->invoke([this, cmd, key, promise](dispatcher::cancellable_timer t)
+                {
+                    complete(cmd, key, *promise, true);
+                });
+                return result;
+            }
+        }
+
+        // The dispatcher would evict the oldest queued command, so the caller runs this one itself
+        complete(cmd, key, *promise, false);
+        return result;
+    }
+
+    void hw_monitor::complete(const command& cmd, const std::vector<uint8_t>& key, std::promise<std::vector<uint8_t>>& result, bool queued) const
+    {
+        try
+        {
+            result.set_value(send(cmd));
+        }
+        catch (...)
+        {
+            result.set_exception(std::current_exception());
+        }
+
+        std::lock_guard<std::mutex> lock(_queue_mutex);
+        if (cmd.coalesce)
+            _in_flight.erase(key);
+        if (queued)
+            --_pending;
+    }
+
     void hw_monitor::get_gvd(size_t sz, unsigned char* gvd, uint8_t gvd_cmd) const
     {
         command command(gvd_cmd);
-        auto data = send(command);
+        command.coalesce = true;
+        auto data = send_async(command).get();
         auto minSize = std::min(sz, data.size());
         librealsense::copy(gvd, data.data(), minSize);
     }
@@ -149,18 +217,42 @@ namespace librealsense
     {
         std::vector<unsigned char> gvd(HW_MONITOR_BUFFER_SIZE);
         get_gvd(gvd.size(), gvd.data(), gvd_cmd);
-        uint8_t fws[8];
-        librealsense::copy(fws, gvd.data() + offset, 8);
-        return to_string() << static_cast<int>(fws[3]) << "." << static_cast<int>(fws[2])
-            << "." << static_cast<int>(fws[1]) << "." << static_cast<int>(fws[0]);
+        return get_firmware_version_string(gvd, offset);
     }
 
     std::string hw_monitor::get_module_serial_string(uint8_t gvd_cmd, uint32_t offset) const
     {
         std::vector<unsigned char> gvd(HW_MONITOR_BUFFER_SIZE);
         get_gvd(gvd.size(), gvd.data(), gvd_cmd);
-        unsigned char ss[8];
-        librealsense::copy(ss, gvd.data() + offset, 8);
+        return get_module_serial_string(gvd, offset);
+    }
+
+    bool hw_monitor::is_camera_locked(uint8_t gvd_cmd, uint32_t offset) const
+    {
+        std::vector<unsigned char> gvd(HW_MONITOR_BUFFER_SIZE);
+        get_gvd(gvd.size(), gvd.data(), gvd_cmd);
+        return is_camera_locked(gvd, offset);
+    }
+
+    // Fields past the end of a short GVD read as zeros, as they do from the zero initialized GVD buffer
+    static std::vector<uint8_t> get_gvd_field(const std::vector<uint8_t>& gvd, uint32_t offset, size_t size)
+    {
+        std::vector<uint8_t> field(size);
+        if (offset < gvd.size())
+            librealsense::copy(field.data(), gvd.data() + offset, std::min(size, gvd.size() - offset));
+        return field;
+    }
+
+    std::string hw_monitor::get_firmware_version_string(const std::vector<uint8_t>& gvd, uint32_t offset)
+    {
+        auto fws = get_gvd_field(gvd, offset, 8);
+        return to_string() << static_cast<int>(fws[3]) << "." << static_cast<int>(fws[2])
+            << "." << static_cast<int>(fws[1]) << "." << static_cast<int>(fws[0]);
+    }
+
+    std::string hw_monitor::get_module_serial_string(const std::vector<uint8_t>& gvd, uint32_t offset)
+    {
+        auto ss = get_gvd_field(gvd, offset, 8);
         std::stringstream formattedBuffer;
         formattedBuffer << std::setfill('0') << std::setw(2) << std::hex << static_cast<int>(ss[0]) <<
             std::setfill('0') << std::setw(2) << std::hex << static_cast<int>(ss[1]) <<
@@ -172,12 +264,8 @@ namespace librealsense
         return formattedBuffer.str();
     }
 
-    bool hw_monitor::is_camera_locked(uint8_t gvd_cmd, uint32_t offset) const
+    bool hw_monitor::is_camera_locked(const std::vector<uint8_t>& gvd, uint32_t offset)
     {
-        std::vector<unsigned char> gvd(HW_MONITOR_BUFFER_SIZE);
-        get_gvd(gvd.size(), gvd.data(), gvd_cmd);
-        bool value;
-        librealsense::copy(&value, gvd.data() + offset, 1);
-        return value;
+        return get_gvd_field(gvd, offset, 1)[0] != 0;
     }
 }
@@ -4,6 +4,9 @@
 #pragma once
 
 #include "sensor.h"
+#include "concurrency.h"
+#include <future>
+#include <map>
 #include <mutex>
 
 const uint8_t   IV_COMMAND_FIRMWARE_UPDATE_MODE = 0x01;
@@ -38,6 +41,7 @@ const uint16_t  HW_MONITOR_COMMAND_SIZE         = 1000;
 const uint16_t  HW_MONITOR_BUFFER_SIZE          = 1024;
 const uint16_t  HW_MONITOR_DATA_SIZE_OFFSET     = 1020;
 const uint16_t  SIZE_OF_HW_MONITOR_HEADER       = 4;
+const uint16_t  HW_MONITOR_QUEUE_SIZE           = 64;
 
 
 
@@ -83,6 +87,7 @@ namespace librealsense
         std::vector<uint8_t> data;
         int     timeout_ms = 5000;
         bool    require_response = true;
+        bool    coalesce = false; // Identical queued commands share a single transfer, only for commands without side effects
 
         explicit command(uint8_t cmd, int param1 = 0, int param2 = 0,
                 int param3 = 0, int param4 = 0, int timeout_ms = 5000,
@@ -152,11 +157,17 @@ namespace librealsense
         };
 
         static void fill_usb_buffer(int opCodeNumber, int p1, int p2, int p3, int p4, uint8_t* data, int dataLength, uint8_t* bufferToSend, int& length);
-        void execute_usb_command(uint8_t *out, size_t outSize, uint32_t& op, uint8_t* in, size_t& inSize) const;
+        void execute_usb_command(uint8_t *out, size_t outSize, uint32_t& op, uint8_t* in, size_t& inSize, int timeout_ms) const;
         static void update_cmd_details(hwmon_cmd_details& details, size_t receivedCmdLen, unsigned char* outputBuffer);
         void send_hw_monitor_command(hwmon_cmd_details& details) const;
+        void complete(const command& cmd, const std::vector<uint8_t>& key, std::promise<std::vector<uint8_t>>& result, bool queued) const;
 
         std::shared_ptr<locked_transfer> _locked_transfer;
+
+        mutable std::mutex _queue_mutex;
+        mutable std::map<std::vector<uint8_t>, std::shared_future<std::vector<uint8_t>>> _in_flight; // Coalesced commands by their USB buffer
+        mutable size_t _pending = 0;
+        mutable std::unique_ptr<dispatcher> _dispatcher; // Created on first use, destroyed first to stop the commands that use the members above
     public:
         explicit hw_monitor(std::shared_ptr<locked_transfer> locked_transfer)
             : _locked_transfer(std::move(locked_transfer))
@@ -164,9 +175,17 @@ namespace librealsense
 
         std::vector<uint8_t> send(std::vector<uint8_t> data) const;
         std::vector<uint8_t> send(command cmd) const;
+        // Queues the command on the monitor thread, in order with the other queued commands, so callers can issue
+        // several commands back to back and wait for their results later
+        std::shared_future<std::vector<uint8_t>> send_async(command cmd) const;
         void get_gvd(size_t sz, unsigned char* gvd, uint8_t gvd_cmd) const;
         std::string get_firmware_version_string(int gvd_cmd, uint32_t offset) const;
         std::string get_module_serial_string(uint8_t gvd_cmd, uint32_t offset) const;
         bool is_camera_locked(uint8_t gvd_cmd, uint32_t offset) const;
+
+        // Parse a GVD that was already read, so that several fields cost a single command
+        static std::string get_firmware_version_string(const std::vector<uint8_t>& gvd, uint32_t offset);
+        static std::string get_module_serial_string(const std::vector<uint8_t>& gvd, uint32_t offset);
+        static bool is_camera_locked(const std::vector<uint8_t>& gvd, uint32_t offset);
     };
 }
@@ -425,6 +425,7 @@ namespace librealsense
         void hardware_reset() override
         {
             force_hardware_reset();
+            invalidate_option_caches();
         }
 
         uvc_sensor& get_depth_sensor() { return dynamic_cast<uvc_sensor&>(get_sensor(_depth_device_idx)); }
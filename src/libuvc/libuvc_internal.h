@@ -228,16 +228,23 @@ typedef struct uvc_device_info {
 } uvc_device_info_t;
 
 /*
-  set a high number of transfer buffers. This uses a lot of ram, but
-  avoids problems with scheduling delays on slow boards causing missed
-  transfers. A better approach may be to make the transfer thread FIFO
-  scheduled (if we have root).
-  We could/should change this to allow reduce it to, say, 5 by default
-  and then allow the user to change the number of buffers as required.
+  Number of bulk transfers kept queued on each stream. While one completed transfer
+  is being processed the others stay in flight, which avoids missed transfers
+  when the host is slow to resubmit (scheduling delays on slow boards, high
+  resolutions). Each transfer holds dwMaxPayloadTransferSize bytes.
+  Override with the LIBUVC_TRANSFER_BUFS CMake variable.
  */
-#define LIBUVC_NUM_TRANSFER_BUFS 1
+#ifndef LIBUVC_NUM_TRANSFER_BUFS
+#define LIBUVC_NUM_TRANSFER_BUFS 4
+#endif
 
+/*
+  Size of a frame buffer, used only when the device does not report
+  dwMaxVideoFrameSize. Override with the LIBUVC_FRAME_BUF_SIZE CMake variable.
+ */
+#ifndef LIBUVC_XFER_BUF_SIZE
 #define LIBUVC_XFER_BUF_SIZE	( 16 * 1024 * 1024 )
+#endif
 
 struct uvc_stream_handle {
     struct uvc_device_handle *devh;
@@ -258,7 +265,11 @@ struct uvc_stream_handle {
     uint8_t *metadata_buf;
     size_t metadata_bytes,metadata_size;
     size_t got_bytes, hold_bytes;
+    /* outbuf is filled by the transfer callback, holdbuf holds the last complete
+     * frame and frame.data the frame handed to the user. The three buffers
+     * rotate instead of being copied */
     uint8_t *outbuf, *holdbuf;
+    size_t frame_buf_size;
     std::mutex cb_mutex;
     std::condition_variable cb_cond;
     std::thread cb_thread;
@@ -814,6 +814,11 @@ void _uvc_process_payload(uvc_stream_handle_t *strmh, uint8_t *payload, size_t p
   }
 
   if (data_len > 0) {
+    if (strmh->got_bytes + data_len > strmh->frame_buf_size) {
+      UVC_DEBUG("frame overflow: got_bytes=%zd, data_len=%zd", strmh->got_bytes, data_len);
+      data_len = strmh->frame_buf_size - strmh->got_bytes;
+    }
+
     memcpy(strmh->outbuf + strmh->got_bytes, payload + header_len, data_len);
     strmh->got_bytes += data_len;
 
@@ -1028,9 +1033,11 @@ uvc_error_t uvc_stream_open_ctrl(uvc_device_handle_t *devh, uvc_stream_handle_t
 
     // Set up the streaming status and data space
     strmh->running = 0;
-    /** @todo take only what we need */
-    strmh->outbuf = (uint8_t *)malloc( LIBUVC_XFER_BUF_SIZE );
-    strmh->holdbuf = (uint8_t *)malloc( LIBUVC_XFER_BUF_SIZE );
+    strmh->frame_buf_size = strmh->cur_ctrl.dwMaxVideoFrameSize ?
+        strmh->cur_ctrl.dwMaxVideoFrameSize : LIBUVC_XFER_BUF_SIZE;
+    strmh->outbuf = (uint8_t *)malloc( strmh->frame_buf_size );
+    strmh->holdbuf = (uint8_t *)malloc( strmh->frame_buf_size );
+    strmh->frame.data = malloc( strmh->frame_buf_size );
 
     strmh->metadata_buf = (uint8_t *)malloc( 2048 );
     strmh->metadata_size = 2048;
@@ -1209,6 +1216,7 @@ void _uvc_populate_frame(uvc_stream_handle_t *strmh) {
   size_t alloc_size = strmh->cur_ctrl.dwMaxVideoFrameSize;
   uvc_frame_t *frame = &strmh->frame;
   uvc_frame_desc_t *frame_desc;
+  uint8_t *tmp_buf;
 
   /** @todo this stuff that hits the main config cache should really happen
    * in start() so that only one thread hits these data. all of this stuff
@@ -1239,12 +1247,12 @@ void _uvc_populate_frame(uvc_stream_handle_t *strmh) {
   /** @todo set the frame time */
   // frame->capture_time
 
-  /* copy the image data from the hold buffer to the frame (unnecessary extra buf?) */
-  if (frame->data_bytes < strmh->hold_bytes) {
-    frame->data = realloc(frame->data, strmh->hold_bytes);
-  }
+  /* hand the hold buffer to the frame without copying. The buffer of the previous
+   * frame is no longer used by the caller, and becomes the next hold buffer */
+  tmp_buf = (uint8_t *)frame->data;
+  frame->data = strmh->holdbuf;
+  strmh->holdbuf = tmp_buf;
   frame->data_bytes = strmh->hold_bytes;
-  memcpy(frame->data, strmh->holdbuf, frame->data_bytes);
 
     /* copy the header data from the buffer to the frame */
 
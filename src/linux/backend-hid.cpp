@@ -212,7 +212,7 @@ namespace librealsense
 
 
         // start capturing and polling.
-        void hid_custom_sensor::start_capture(hid_callback sensor_callback)
+        void hid_custom_sensor::start_capture(hid_batch_callback sensor_callback)
         {
             if (_is_capturing)
                 return;
@@ -259,9 +259,17 @@ namespace librealsense
 
             _callback = sensor_callback;
             _is_capturing = true;
+            _reactor = capture_reactor::get();
+            if (_reactor)
+            {
+                _raw_data.resize(channel_size * buf_len);
+                _reactor->add(_fd, [this]() { read_samples(_raw_data); },
+                              [this]() { LOG_WARNING("hid_custom_sensor: Frames didn't arrived within 5 seconds"); },
+                              std::chrono::seconds(5));
+                return;
+            }
+
             _hid_thread = std::unique_ptr<std::thread>(new std::thread([this, read_device_path_str](){
-                static const uint32_t buf_len = 128;
-                const uint32_t channel_size = 24; // TODO: why 24?
                 std::vector<uint8_t> raw_data(channel_size * buf_len);
 
                 do {
@@ -271,7 +279,6 @@ namespace librealsense
                     FD_SET(_stop_pipe_fd[0], &fds);
 
                     int max_fd = std::max(_stop_pipe_fd[0], _fd);
-                    size_t read_size = 0;
 
                     struct timeval tv = {5,0};
                     auto val = select(max_fd + 1, &fds, NULL, NULL, &tv);
@@ -292,27 +299,13 @@ namespace librealsense
                         }
                         else if (FD_ISSET(_fd, &fds))
                         {
-                            read_size = read(_fd, raw_data.data(), raw_data.size());
-                            if (read_size <= 0 )
-                                continue;
+                            read_samples(raw_data);
                         }
                         else
                         {
                             // TODO: write to log?
                             continue;
                         }
-
-                        for (auto i = 0; i < read_size / channel_size; ++i)
-                        {
-                            auto p_raw_data = raw_data.data() + channel_size * i;
-
-                            // TODO: code refactoring to reduce latency
-                            sensor_data sens_data{};
-                            sens_data.sensor = hid_sensor{get_sensor_name()};
-
-                            sens_data.fo = {channel_size, channel_size, p_raw_data, p_raw_data};
-                            this->_callback(sens_data);
-                        }
                     }
                     else
                     {
@@ -328,8 +321,16 @@ namespace librealsense
                 return;
 
             _is_capturing = false;
-            signal_stop();
-            _hid_thread->join();
+            if (_reactor)
+            {
+                _reactor->remove(_fd);
+                _reactor.reset();
+            }
+            else
+            {
+                signal_stop();
+                _hid_thread->join();
+            }
             enable(false);
             _callback = NULL;
 
@@ -345,6 +346,26 @@ namespace librealsense
             _stop_pipe_fd[0] = _stop_pipe_fd[1] = 0;
         }
 
+        void hid_custom_sensor::read_samples(std::vector<uint8_t>& raw_data)
+        {
+            auto read_size = read(_fd, raw_data.data(), raw_data.size());
+            if (read_size <= 0)
+                return;
+
+            _samples.clear();
+            for (auto i = 0; i < read_size / channel_size; ++i)
+            {
+                auto p_raw_data = raw_data.data() + channel_size * i;
+
+                sensor_data sens_data{};
+                sens_data.sensor = hid_sensor{get_sensor_name()};
+
+                sens_data.fo = {channel_size, channel_size, p_raw_data, p_raw_data};
+                _samples.push_back(sens_data);
+            }
+            this->_callback(_samples);
+        }
+
         std::vector<uint8_t> hid_custom_sensor::read_report(const std::string& name_report_path)
         {
             auto fd = open(name_report_path.c_str(), O_RDONLY | O_NONBLOCK);
@@ -460,7 +481,7 @@ namespace librealsense
         }
 
         // start capturing and polling.
-        void iio_hid_sensor::start_capture(hid_callback sensor_callback)
+        void iio_hid_sensor::start_capture(hid_batch_callback sensor_callback)
         {
             if (_is_capturing)
                 return;
@@ -508,12 +529,18 @@ namespace librealsense
 
             _callback = sensor_callback;
             _is_capturing = true;
-            _hid_thread = std::unique_ptr<std::thread>(new std::thread([this](){
-                const uint32_t channel_size = get_channel_size();
-                auto raw_data_size = channel_size*buf_len;
+            _reactor = capture_reactor::get();
+            if (_reactor)
+            {
+                _raw_data.resize(get_channel_size() * buf_len);
+                _reactor->add(_fd, [this]() { read_samples(_raw_data); },
+                              [this]() { LOG_WARNING("iio_hid_sensor: Frames didn't arrived within 5 seconds"); },
+                              std::chrono::seconds(5));
+                return;
+            }
 
-                std::vector<uint8_t> raw_data(raw_data_size);
-                auto metadata = has_metadata();
+            _hid_thread = std::unique_ptr<std::thread>(new std::thread([this](){
+                std::vector<uint8_t> raw_data(get_channel_size() * buf_len);
 
                 do {
                     fd_set fds;
@@ -522,7 +549,6 @@ namespace librealsense
                     FD_SET(_stop_pipe_fd[0], &fds);
 
                     int max_fd = std::max(_stop_pipe_fd[0], _fd);
-                    auto read_size = 0;
 
                     struct timeval tv = {5, 0};
                     auto val = select(max_fd + 1, &fds, NULL, NULL, &tv);
@@ -543,29 +569,13 @@ namespace librealsense
                         }
                         else if (FD_ISSET(_fd, &fds))
                         {
-                            read_size = read(_fd, raw_data.data(), raw_data_size);
-                            if (read_size < 0 )
-                                continue;
+                            read_samples(raw_data);
                         }
                         else
                         {
                             // TODO: write to log?
                             continue;
                         }
-
-                        // TODO: code refactoring to reduce latency
-                        for (auto i = 0; i < read_size / channel_size; ++i)
-                        {
-                            auto p_raw_data = raw_data.data() + channel_size * i;
-                            sensor_data sens_data{};
-                            sens_data.sensor = hid_sensor{get_sensor_name()};
-
-                            auto hid_data_size = channel_size - HID_METADATA_SIZE;
-
-                            sens_data.fo = {hid_data_size, metadata?HID_METADATA_SIZE: uint8_t(0),  p_raw_data,  metadata?p_raw_data + hid_data_size:nullptr};
-
-                            this->_callback(sens_data);
-                        }
                     }
                     else
                     {
@@ -575,14 +585,48 @@ namespace librealsense
             }));
         }
 
+        void iio_hid_sensor::read_samples(std::vector<uint8_t>& raw_data)
+        {
+            const uint32_t channel_size = get_channel_size();
+            auto metadata = has_metadata();
+
+            auto read_size = read(_fd, raw_data.data(), raw_data.size());
+            if (read_size <= 0)
+                return;
+
+            _samples.clear();
+            for (auto i = 0; i < read_size / channel_size; ++i)
+            {
+                auto p_raw_data = raw_data.data() + channel_size * i;
+                sensor_data sens_data{};
+                sens_data.sensor = hid_sensor{get_sensor_name()};
+
+                auto hid_data_size = channel_size - HID_METADATA_SIZE;
+
+                sens_data.fo = {hid_data_size, metadata?HID_METADATA_SIZE: uint8_t(0),  p_raw_data,  metadata?p_raw_data + hid_data_size:nullptr};
+
+                _samples.push_back(sens_data);
+            }
+            // All the samples of a read are delivered at once
+            this->_callback(_samples);
+        }
+
         void iio_hid_sensor::stop_capture()
         {
             if (!_is_capturing)
                 return;
 
             _is_capturing = false;
-            signal_stop();
-            _hid_thread->join();
+            if (_reactor)
+            {
+                _reactor->remove(_fd);
+                _reactor.reset();
+            }
+            else
+            {
+                signal_stop();
+                _hid_thread->join();
+            }
             _callback = NULL;
             _channels.clear();
 
@@ -968,6 +1012,15 @@ namespace librealsense
         }
 
         void v4l_hid_device::start_capture(hid_callback callback)
+        {
+            start_batch_capture([callback](const std::vector<sensor_data>& samples)
+            {
+                for (auto&& sample : samples)
+                    callback(sample);
+            });
+        }
+
+        void v4l_hid_device::start_batch_capture(hid_batch_callback callback)
         {
             for (auto& profile : _hid_profiles)
             {
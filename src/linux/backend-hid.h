@@ -3,6 +3,7 @@
 #pragma once
 
 #include "backend.h"
+#include "backend-reactor.h"
 #include "types.h"
 
 #include <cassert>
@@ -89,7 +90,7 @@ namespace librealsense
             const std::string& get_sensor_name() const { return _custom_sensor_name; }
 
             // start capturing and polling.
-            void start_capture(hid_callback sensor_callback);
+            void start_capture(hid_batch_callback sensor_callback);
 
             void stop_capture();
         private:
@@ -101,15 +102,23 @@ namespace librealsense
 
             void signal_stop();
 
+            // read the available samples into raw_data and pass them to the callback
+            void read_samples(std::vector<uint8_t>& raw_data);
+
+            static const uint32_t buf_len = 128;
+            static const uint32_t channel_size = 24; // TODO: why 24?
             int _stop_pipe_fd[2]; // write to _stop_pipe_fd[1] and read from _stop_pipe_fd[0]
             int _fd;
             std::map<std::string, std::string> _reports;
             std::string _custom_device_path;
             std::string _custom_sensor_name;
             std::string _custom_device_name;
-            hid_callback _callback;
+            hid_batch_callback _callback;
             std::atomic<bool> _is_capturing;
             std::unique_ptr<std::thread> _hid_thread;
+            std::shared_ptr<capture_reactor> _reactor; // Replaces the capture thread when the backend is built with the reactor
+            std::vector<uint8_t> _raw_data;
+            std::vector<sensor_data> _samples; // samples of the last read, passed to the callback at once
         };
 
         // declare device sensor with all of its inputs.
@@ -120,7 +129,7 @@ namespace librealsense
             ~iio_hid_sensor();
 
             // start capturing and polling.
-            void start_capture(hid_callback sensor_callback);
+            void start_capture(hid_batch_callback sensor_callback);
 
             void stop_capture();
 
@@ -135,6 +144,9 @@ namespace librealsense
 
             bool has_metadata();
 
+            // read the available samples into raw_data and pass them to the callback
+            void read_samples(std::vector<uint8_t>& raw_data);
+
             static bool sort_hids(hid_input* first, hid_input* second);
 
             void create_channel_array();
@@ -165,9 +177,12 @@ namespace librealsense
             std::string _sampling_frequency_name;
             std::list<hid_input*> _inputs;
             std::list<hid_input*> _channels;
-            hid_callback _callback;
+            hid_batch_callback _callback;
             std::atomic<bool> _is_capturing;
             std::unique_ptr<std::thread> _hid_thread;
+            std::shared_ptr<capture_reactor> _reactor; // Replaces the capture thread when the backend is built with the reactor
+            std::vector<uint8_t> _raw_data;
+            std::vector<sensor_data> _samples; // samples of the last read, passed to the callback at once
         };
 
         class v4l_hid_device : public hid_device
@@ -185,6 +200,8 @@ namespace librealsense
 
             void start_capture(hid_callback callback);
 
+            void start_batch_capture(hid_batch_callback callback) override;
+
             void stop_capture();
 
             std::vector<uint8_t> get_custom_report_data(const std::string& custom_sensor_name,
@@ -0,0 +1,325 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2015 Intel Corporation. All Rights Reserved.
+
+#ifdef RS2_USE_V4L2_BACKEND
+
+#include "backend-reactor.h"
+#include "types.h"
+
+#include <cstdlib>
+#include <sstream>
+#include <string>
+
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+
+#ifndef RS2_CAPTURE_REACTOR_THREADS
+#define RS2_CAPTURE_REACTOR_THREADS 1
+#endif
+
+namespace librealsense
+{
+    namespace platform
+    {
+        // Maximal time between checks for streams that stopped delivering data
+        const int REACTOR_TICK_MS = 1000;
+        const int REACTOR_MAX_EVENTS = 16;
+
+        // Comma separated list of the CPUs the reactor threads are pinned to, for example LRS_CAPTURE_CPUS=2,3
+        static std::vector<int> get_capture_cpus()
+        {
+            std::vector<int> cpus;
+            auto content = getenv("LRS_CAPTURE_CPUS");
+            if (!content)
+                return cpus;
+
+            std::stringstream ss(content);
+            std::string cpu;
+            while (std::getline(ss, cpu, ','))
+            {
+                try
+                {
+                    cpus.push_back(std::stoi(cpu));
+                }
+                catch (const std::exception&)
+                {
+                    LOG_WARNING("capture_reactor: ignoring invalid CPU '" << cpu << "' in LRS_CAPTURE_CPUS");
+                }
+            }
+            return cpus;
+        }
+
+        std::shared_ptr<capture_reactor> capture_reactor::get()
+        {
+#ifdef RS2_USE_CAPTURE_REACTOR
+            // The reactor threads live only while some stream is capturing
+            static std::mutex mtx;
+            static std::weak_ptr<capture_reactor> instance;
+
+            std::lock_guard<std::mutex> lock(mtx);
+            auto reactor = instance.lock();
+            if (!reactor)
+            {
+                reactor = std::make_shared<capture_reactor>(RS2_CAPTURE_REACTOR_THREADS, get_capture_cpus());
+                instance = reactor;
+            }
+            return reactor;
+#else
+            return nullptr;
+#endif
+        }
+
+        capture_reactor::capture_reactor(size_t threads, const std::vector<int>& cpus)
+        {
+            try
+            {
+                start_workers(threads, cpus);
+            }
+            catch (...)
+            {
+                stop_workers();
+                throw;
+            }
+        }
+
+        capture_reactor::~capture_reactor()
+        {
+            stop_workers();
+        }
+
+        void capture_reactor::start_workers(size_t threads, const std::vector<int>& cpus)
+        {
+            for (size_t i = 0; i < std::max<size_t>(threads, 1); ++i)
+            {
+                std::unique_ptr<worker> w(new worker());
+                w->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+                if (w->epoll_fd < 0)
+                    throw linux_backend_exception("capture_reactor: epoll_create1 failed");
+
+                w->stop_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+                if (w->stop_fd < 0)
+                    throw linux_backend_exception("capture_reactor: eventfd failed");
+
+                epoll_event ev{};
+                ev.events = EPOLLIN;
+                ev.data.fd = w->stop_fd;
+                if (epoll_ctl(w->epoll_fd, EPOLL_CTL_ADD, w->stop_fd, &ev) < 0)
+                    throw linux_backend_exception("capture_reactor: epoll_ctl(EPOLL_CTL_ADD) failed");
+
+                auto raw = w.get();
+                w->thread = std::thread([this, raw]() { run(*raw); });
+
+                if (!cpus.empty())
+                {
+                    cpu_set_t set;
+                    CPU_ZERO(&set);
+                    CPU_SET(cpus[i % cpus.size()], &set);
+                    if (pthread_setaffinity_np(w->thread.native_handle(), sizeof(set), &set) != 0)
+                        LOG_WARNING("capture_reactor: failed to pin thread " << i << " to CPU " << cpus[i % cpus.size()]);
+                }
+
+                _workers.push_back(std::move(w));
+            }
+        }
+
+        void capture_reactor::stop_workers()
+        {
+            for (auto&& w : _workers)
+            {
+                uint64_t value = 1;
+                if (write(w->stop_fd, &value, sizeof(value)) < 0)
+                    LOG_ERROR("capture_reactor: could not signal reactor thread to stop");
+            }
+
+            std::vector<std::unique_ptr<worker>> workers;
+            workers.swap(_workers);
+            for (auto&& w : workers)
+            {
+                // When the last reference is released by a handler, the reactor thread cannot join itself: it finishes
+                // on its next wakeup, and a thread of their own joins the workers and destroys them meanwhile
+                if (w->thread.get_id() == std::this_thread::get_id())
+                {
+                    auto orphans = std::make_shared<std::vector<std::unique_ptr<worker>>>(std::move(workers));
+                    std::thread([orphans]() { join_workers(*orphans); }).detach();
+                    return;
+                }
+            }
+            join_workers(workers);
+        }
+
+        void capture_reactor::join_workers(std::vector<std::unique_ptr<worker>>& workers)
+        {
+            for (auto&& w : workers)
+            {
+                if (w->thread.joinable())
+                    w->thread.join();
+            }
+            workers.clear();
+        }
+
+        capture_reactor::worker::~worker()
+        {
+            if (stop_fd >= 0)
+                ::close(stop_fd);
+            if (epoll_fd >= 0)
+                ::close(epoll_fd);
+        }
+
+        void capture_reactor::add(int fd, std::function<void()> on_readable, std::function<void()> on_timeout,
+                                  std::chrono::milliseconds timeout)
+        {
+            worker* target = nullptr;
+            {
+                std::lock_guard<std::mutex> lock(_mtx);
+                if (_assignments.count(fd))
+                    throw wrong_api_call_sequence_exception("capture_reactor: file descriptor is already registered");
+
+                // Assign the descriptor to the least loaded thread
+                std::map<worker*, size_t> load;
+                for (auto&& w : _workers)
+                    load[w.get()] = 0;
+                for (auto&& kvp : _assignments)
+                    ++load[kvp.second];
+                for (auto&& w : _workers)
+                    if (!target || load[w.get()] < load[target])
+                        target = w.get();
+
+                _assignments[fd] = target;
+            }
+
+            auto reg = std::make_shared<registration>();
+            reg->on_readable = on_readable;
+            reg->on_timeout = on_timeout;
+            reg->timeout = timeout;
+            reg->last_event = std::chrono::steady_clock::now();
+            {
+                std::lock_guard<std::mutex> lock(target->mtx);
+                target->registrations[fd] = reg;
+            }
+
+            epoll_event ev{};
+            ev.events = EPOLLIN;
+            ev.data.fd = fd;
+            if (epoll_ctl(target->epoll_fd, EPOLL_CTL_ADD, fd, &ev) < 0)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(target->mtx);
+                    target->registrations.erase(fd);
+                }
+                std::lock_guard<std::mutex> lock(_mtx);
+                _assignments.erase(fd);
+                throw linux_backend_exception(to_string() << "capture_reactor: epoll_ctl(EPOLL_CTL_ADD) failed for fd " << fd);
+            }
+        }
+
+        void capture_reactor::remove(int fd)
+        {
+            worker* target = nullptr;
+            {
+                std::lock_guard<std::mutex> lock(_mtx);
+                auto it = _assignments.find(fd);
+                if (it == _assignments.end())
+                    return;
+                target = it->second;
+                _assignments.erase(it);
+            }
+
+            if (epoll_ctl(target->epoll_fd, EPOLL_CTL_DEL, fd, nullptr) < 0)
+                LOG_WARNING("capture_reactor: epoll_ctl(EPOLL_CTL_DEL) failed for fd " << fd);
+
+            std::unique_lock<std::mutex> lock(target->mtx);
+            target->registrations.erase(fd);
+
+            // Waits for a running handler of fd to return, unless called on its thread
+            if (target->thread.get_id() != std::this_thread::get_id())
+                target->handler_done.wait(lock, [&]() { return target->running_fd != fd; });
+        }
+
+        void capture_reactor::dispatch(worker& w, const std::function<void()>& handler)
+        {
+            try
+            {
+                handler();
+            }
+            catch (const std::exception& ex)
+            {
+                LOG_ERROR("capture_reactor: " << ex.what());
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(w.mtx);
+                w.running_fd = -1;
+            }
+            w.handler_done.notify_all();
+        }
+
+        void capture_reactor::run(worker& w)
+        {
+            epoll_event events[REACTOR_MAX_EVENTS];
+            while (true)
+            {
+                auto count = epoll_wait(w.epoll_fd, events, REACTOR_MAX_EVENTS, REACTOR_TICK_MS);
+                if (count < 0)
+                {
+                    if (errno == EINTR)
+                        continue;
+                    LOG_ERROR("capture_reactor: epoll_wait failed, errno " << errno);
+                    return;
+                }
+
+                auto now = std::chrono::steady_clock::now();
+                for (int i = 0; i < count; ++i)
+                {
+                    if (events[i].data.fd == w.stop_fd)
+                    {
+                        LOG_INFO("capture_reactor: reactor thread finished");
+                        return;
+                    }
+
+                    // The lock is not held while the handler runs, remove() waits for it on running_fd instead
+                    std::shared_ptr<registration> reg;
+                    {
+                        std::lock_guard<std::mutex> lock(w.mtx);
+                        // A handler may have removed the descriptor of a later event
+                        auto it = w.registrations.find(events[i].data.fd);
+                        if (it == w.registrations.end())
+                            continue;
+
+                        reg = it->second;
+                        reg->last_event = now;
+                        w.running_fd = events[i].data.fd;
+                    }
+                    dispatch(w, reg->on_readable);
+                }
+
+                std::vector<std::pair<int, std::shared_ptr<registration>>> registrations;
+                {
+                    std::lock_guard<std::mutex> lock(w.mtx);
+                    registrations.assign(w.registrations.begin(), w.registrations.end());
+                }
+                for (auto&& kvp : registrations)
+                {
+                    auto reg = kvp.second;
+                    {
+                        std::lock_guard<std::mutex> lock(w.mtx);
+                        auto it = w.registrations.find(kvp.first);
+                        if (it == w.registrations.end() || it->second != reg || now - reg->last_event < reg->timeout)
+                            continue;
+
+                        reg->last_event = now;
+                        if (!reg->on_timeout)
+                            continue;
+                        w.running_fd = kvp.first;
+                    }
+                    dispatch(w, reg->on_timeout);
+                }
+            }
+        }
+    }
+}
+
+#endif
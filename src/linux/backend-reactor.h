@@ -0,0 +1,76 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2015 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace librealsense
+{
+    namespace platform
+    {
+        // Multiplexes the capture file descriptors of the V4L2 and HID streams of the process on a few epoll threads,
+        // instead of running a select() thread per stream.
+        // Handlers of a descriptor always run on the reactor thread the descriptor was assigned to.
+        class capture_reactor
+        {
+        public:
+            // The process-wide reactor, shared by all the streams that are capturing.
+            // Returns nullptr when the backend was built without RS2_USE_CAPTURE_REACTOR.
+            static std::shared_ptr<capture_reactor> get();
+
+            // Reactor threads are pinned to the given CPUs in a round robin, when the list is not empty
+            capture_reactor(size_t threads, const std::vector<int>& cpus);
+            ~capture_reactor();
+
+            // on_readable is called when fd has data to read, on_timeout when no data arrived within timeout
+            void add(int fd, std::function<void()> on_readable, std::function<void()> on_timeout,
+                     std::chrono::milliseconds timeout);
+
+            // Once remove() returns the handlers of fd are not running, and will not be called again.
+            // May be called from within a handler. Only a running handler of fd itself is waited for, so the handlers
+            // on one thread may remove the descriptors of another.
+            void remove(int fd);
+
+        private:
+            struct registration
+            {
+                std::function<void()> on_readable;
+                std::function<void()> on_timeout;
+                std::chrono::milliseconds timeout;
+                std::chrono::steady_clock::time_point last_event;
+            };
+
+            struct worker
+            {
+                ~worker(); // Closes the descriptors, the thread must be joined already
+
+                int epoll_fd = -1;
+                int stop_fd = -1; // eventfd, written to stop the thread
+                std::thread thread;
+                std::mutex mtx; // guards registrations and running_fd, released while handlers run
+                std::condition_variable handler_done;
+                std::map<int, std::shared_ptr<registration>> registrations;
+                int running_fd = -1; // descriptor whose handler is running on the thread
+            };
+
+            void start_workers(size_t threads, const std::vector<int>& cpus);
+            void stop_workers();
+            static void join_workers(std::vector<std::unique_ptr<worker>>& workers);
+            void run(worker& w);
+            static void dispatch(worker& w, const std::function<void()>& handler);
+
+            std::vector<std::unique_ptr<worker>> _workers;
+            std::mutex _mtx;
+            std::map<int, worker*> _assignments;
+        };
+    }
+}
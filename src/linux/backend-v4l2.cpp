@@ -43,6 +43,9 @@
 #include <list>
 
 #include <sys/signalfd.h>
+#include <sys/socket.h>
+#include <linux/netlink.h>
+#include <arpa/inet.h>
 #include <signal.h>
 #pragma GCC diagnostic ignored "-Woverflow"
 
@@ -180,7 +183,7 @@ namespace librealsense
         }
 
 
-        buffer::buffer(int fd, bool use_memory_map, int index)
+        buffer::buffer(int fd, bool use_memory_map, int index, bool export_dmabuf)
             : _use_memory_map(use_memory_map), _index(index)
         {
             v4l2_buffer buf = {};
@@ -199,6 +202,20 @@ namespace librealsense
                                                     fd, buf.m.offset));
                 if(_start == MAP_FAILED)
                     throw linux_backend_exception("mmap failed");
+
+                if (export_dmabuf)
+                {
+                    v4l2_exportbuffer expbuf = {};
+                    expbuf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+                    expbuf.index = index;
+                    expbuf.flags = O_RDONLY | O_CLOEXEC;
+                    if (xioctl(fd, VIDIOC_EXPBUF, &expbuf) < 0)
+                    {
+                        munmap(_start, _length);
+                        throw linux_backend_exception("xioctl(VIDIOC_EXPBUF) failed");
+                    }
+                    _dmabuf_fd = expbuf.fd;
+                }
             }
             else
             {
@@ -227,6 +244,9 @@ namespace librealsense
 
         buffer::~buffer()
         {
+            if (_dmabuf_fd >= 0)
+                ::close(_dmabuf_fd);
+
             if (_use_memory_map)
             {
                if(munmap(_start, _length) < 0)
@@ -243,6 +263,7 @@ namespace librealsense
             std::lock_guard<std::mutex> lock(_mutex);
             _buf = buf;
             _must_enqueue = true;
+            _attach_time = std::chrono::steady_clock::now();
         }
 
         void buffer::detach_buffer()
@@ -251,10 +272,11 @@ namespace librealsense
             _must_enqueue = false;
         }
 
-        void buffer::request_next_frame(int fd)
+        std::chrono::steady_clock::duration buffer::request_next_frame(int fd)
         {
             std::lock_guard<std::mutex> lock(_mutex);
 
+            std::chrono::steady_clock::duration hold_time{};
             if (_must_enqueue)
             {
                 if (V4L2_MEMORY_USERPTR == _use_memory_map)
@@ -267,7 +289,43 @@ namespace librealsense
                     LOG_ERROR("xioctl(VIDIOC_QBUF) failed when requesting new frame! Last-error: " << strerror(errno));
 
                 _must_enqueue = false;
+                hold_time = std::chrono::steady_clock::now() - _attach_time;
             }
+            return hold_time;
+        }
+
+        void capture_monitor::reset(uint32_t buffers)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stats = capture_statistics();
+            _stats.buffers = buffers;
+            _last_sequence = 0;
+        }
+
+        uint32_t capture_monitor::on_frame(uint32_t sequence)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            // The kernel numbers the frames it captures, a gap means frames were dropped for lack of a queued buffer
+            uint32_t dropped = 0;
+            if (_stats.frames && sequence > _last_sequence + 1)
+                dropped = sequence - _last_sequence - 1;
+            _stats.dropped_frames += dropped;
+            _last_sequence = sequence;
+            ++_stats.frames;
+            return dropped;
+        }
+
+        void capture_monitor::on_buffer_released(std::chrono::steady_clock::duration hold_time)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            auto hold_time_ms = std::chrono::duration<double, std::milli>(hold_time).count();
+            _stats.max_hold_time_ms = std::max(_stats.max_hold_time_ms, hold_time_ms);
+        }
+
+        capture_statistics capture_monitor::get_statistics() const
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            return _stats;
         }
 
         static std::tuple<std::string,uint16_t>  get_usb_descriptors(libusb_device* usb_device)
@@ -536,8 +594,10 @@ namespace librealsense
             : _name(""), _info(),
               _is_capturing(false),
               _is_alive(true),
+              _monitor(std::make_shared<capture_monitor>()),
               _thread(nullptr),
               _use_memory_map(use_memory_map),
+              _memory_map_requested(use_memory_map),
               _is_started(false),
               _stop_pipe_fd{}
         {
@@ -654,8 +714,9 @@ namespace librealsense
 
                 for(size_t i = 0; i < buffers; ++i)
                 {
-                    _buffers.push_back(std::make_shared<buffer>(_fd, _use_memory_map, i));
+                    _buffers.push_back(std::make_shared<buffer>(_fd, _use_memory_map, i, _export_dmabuf));
                 }
+                _monitor->reset(buffers);
 
                 _profile =  profile;
                 _callback = callback;
@@ -666,6 +727,17 @@ namespace librealsense
             }
         }
 
+        void v4l_uvc_device::set_dmabuf_export(bool enable)
+        {
+            if (_is_capturing || _callback)
+                throw wrong_api_call_sequence_exception("DMABUF export can not be changed while streaming!");
+
+            // Only memory mapped buffers can be exported. The metadata is appended to USERPTR buffers only,
+            // so it is not available while exporting
+            _export_dmabuf = enable;
+            _use_memory_map = _memory_map_requested || enable;
+        }
+
         void v4l_uvc_device::stream_on(std::function<void(const notification& n)> error_handler)
         {
             if(!_is_capturing)
@@ -680,7 +752,32 @@ namespace librealsense
                     throw linux_backend_exception("xioctl(VIDIOC_STREAMON) failed");
 
                 _is_capturing = true;
-                _thread = std::unique_ptr<std::thread>(new std::thread([this](){ capture_loop(); }));
+                _reactor = capture_reactor::get();
+                if (_reactor)
+                {
+                    _reactor->add(_fd, [this]()
+                    {
+                        try
+                        {
+                            dequeue_frame();
+                        }
+                        catch (const std::exception& ex)
+                        {
+                            LOG_ERROR(ex.what());
+                            // Same as the end of capture_loop(), no frames are read until the stream is closed
+                            _reactor->remove(_fd);
+
+                            librealsense::notification n = {RS2_NOTIFICATION_CATEGORY_UNKNOWN_ERROR, 0, RS2_LOG_SEVERITY_ERROR, ex.what()};
+                            _error_handler(n);
+                        }
+                    },
+                    [this]() { notify_frames_timeout(); },
+                    std::chrono::seconds(5));
+                }
+                else
+                {
+                    _thread = std::unique_ptr<std::thread>(new std::thread([this](){ capture_loop(); }));
+                }
             }
         }
 
@@ -700,10 +797,18 @@ namespace librealsense
             {
                 _is_capturing = false;
                 _is_started = false;
-                signal_stop();
+                if (_reactor)
+                {
+                    _reactor->remove(_fd);
+                    _reactor.reset();
+                }
+                else
+                {
+                    signal_stop();
 
-                _thread->join();
-                _thread.reset();
+                    _thread->join();
+                    _thread.reset();
+                }
 
 
                 // Stop streamining
@@ -814,82 +919,93 @@ namespace librealsense
                 }
                 else if(FD_ISSET(_fd, &fds))
                 {
-                    FD_ZERO(&fds);
-                    FD_SET(_fd, &fds);
-                    v4l2_buffer buf = {};
-                    buf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
-                    buf.memory = _use_memory_map ? V4L2_MEMORY_MMAP : V4L2_MEMORY_USERPTR;
-                    if(xioctl(_fd, VIDIOC_DQBUF, &buf) < 0)
-                    {
-                        if(errno == EAGAIN)
-                            return;
-
-                        throw linux_backend_exception("xioctl(VIDIOC_DQBUF) failed");
-                    }
+                    dequeue_frame();
+                }
+                else
+                {
+                    throw linux_backend_exception("FD_ISSET returned false");
+                }
+            }
+            else
+            {
+                notify_frames_timeout();
+            }
+        }
 
-                    bool moved_qbuff = false;
-                    auto buffer = _buffers[buf.index];
+        void v4l_uvc_device::notify_frames_timeout()
+        {
+            LOG_WARNING("Frames didn't arrived within 5 seconds");
+            librealsense::notification n = {RS2_NOTIFICATION_CATEGORY_FRAMES_TIMEOUT, 0, RS2_LOG_SEVERITY_WARN,  "Frames didn't arrived within 5 seconds"};
 
-                    if (_is_started)
-                    {
-                        if((buf.bytesused < buffer->get_full_length() - MAX_META_DATA_SIZE) &&
-                                buf.bytesused > 0)
-                        {
-                            auto percentage = (100 * buf.bytesused) / buffer->get_full_length();
-                            std::stringstream s;
-                            s << "Incomplete frame detected!\nSize " << buf.bytesused
-                              << " out of " << buffer->get_full_length() << " bytes (" << percentage << "%)";
-                            librealsense::notification n = { RS2_NOTIFICATION_CATEGORY_FRAME_CORRUPTED, 0, RS2_LOG_SEVERITY_WARN, s.str()};
+            _error_handler(n);
+        }
 
-                            _error_handler(n);
-                        }
-                        else if (buf.bytesused > 0)
-                        {
-                            void* md_start = nullptr;
-                            uint8_t md_size = 0;
-                            if (has_metadata())
-                            {
-                                md_start = buffer->get_frame_start() + buffer->get_length_frame_only();
-                                md_size = (*(uint8_t*)md_start);
-                            }
+        void v4l_uvc_device::dequeue_frame()
+        {
+            v4l2_buffer buf = {};
+            buf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+            buf.memory = _use_memory_map ? V4L2_MEMORY_MMAP : V4L2_MEMORY_USERPTR;
+            if(xioctl(_fd, VIDIOC_DQBUF, &buf) < 0)
+            {
+                if(errno == EAGAIN)
+                    return;
 
-                            auto timestamp = (double)buf.timestamp.tv_sec*1000.f + (double)buf.timestamp.tv_usec/1000.f;
-                            timestamp = monotonic_to_realtime(timestamp);
+                throw linux_backend_exception("xioctl(VIDIOC_DQBUF) failed");
+            }
 
-                            frame_object fo{ buffer->get_length_frame_only(), md_size,
-                                buffer->get_frame_start(), md_start, timestamp };
+            bool moved_qbuff = false;
+            auto buffer = _buffers[buf.index];
+            auto dropped_frames = _monitor->on_frame(buf.sequence);
 
-                             buffer->attach_buffer(buf);
-                             moved_qbuff = true;
-                             auto fd = _fd;
-                             _callback(_profile, fo,
-                                       [fd, buffer]() mutable {
-                                 buffer->request_next_frame(fd);
-                             });
-                        }
-                        else
-                        {
-                            LOG_WARNING("Empty frame has arrived.");
-                        }
-                    }
+            if (_is_started)
+            {
+                if((buf.bytesused < buffer->get_full_length() - MAX_META_DATA_SIZE) &&
+                        buf.bytesused > 0)
+                {
+                    auto percentage = (100 * buf.bytesused) / buffer->get_full_length();
+                    std::stringstream s;
+                    s << "Incomplete frame detected!\nSize " << buf.bytesused
+                      << " out of " << buffer->get_full_length() << " bytes (" << percentage << "%)";
+                    librealsense::notification n = { RS2_NOTIFICATION_CATEGORY_FRAME_CORRUPTED, 0, RS2_LOG_SEVERITY_WARN, s.str()};
 
-                    if (!moved_qbuff)
+                    _error_handler(n);
+                }
+                else if (buf.bytesused > 0)
+                {
+                    void* md_start = nullptr;
+                    uint8_t md_size = 0;
+                    if (has_metadata())
                     {
-                        if (xioctl(_fd, VIDIOC_QBUF, &buf) < 0)
-                            throw linux_backend_exception("xioctl(VIDIOC_QBUF) failed");
+                        md_start = buffer->get_frame_start() + buffer->get_length_frame_only();
+                        md_size = (*(uint8_t*)md_start);
                     }
+
+                    auto timestamp = (double)buf.timestamp.tv_sec*1000.f + (double)buf.timestamp.tv_usec/1000.f;
+                    timestamp = monotonic_to_realtime(timestamp);
+
+                    frame_object fo{ buffer->get_length_frame_only(), md_size,
+                        buffer->get_frame_start(), md_start, timestamp, buffer->get_dmabuf_fd(),
+                        buf.sequence, os_time_service().get_time(), dropped_frames };
+
+                     buffer->attach_buffer(buf);
+                     moved_qbuff = true;
+                     auto fd = _fd;
+                     auto monitor = _monitor;
+                     _callback(_profile, fo,
+                               [fd, buffer, monitor]() mutable {
+                         monitor->on_buffer_released(buffer->request_next_frame(fd));
+                     });
                 }
                 else
                 {
-                    throw linux_backend_exception("FD_ISSET returned false");
+                    LOG_WARNING("Empty frame has arrived.");
                 }
             }
-            else
-            {
-                LOG_WARNING("Frames didn't arrived within 5 seconds");
-                librealsense::notification n = {RS2_NOTIFICATION_CATEGORY_FRAMES_TIMEOUT, 0, RS2_LOG_SEVERITY_WARN,  "Frames didn't arrived within 5 seconds"};
 
-                _error_handler(n);
+            if (!moved_qbuff)
+            {
+                if (xioctl(_fd, VIDIOC_QBUF, &buf) < 0)
+                    throw linux_backend_exception("xioctl(VIDIOC_QBUF) failed");
             }
         }
 
@@ -1318,7 +1434,269 @@ namespace librealsense
 
         std::shared_ptr<device_watcher> v4l_backend::create_device_watcher() const
         {
-            return std::make_shared<polling_device_watcher>(this);
+            try
+            {
+                return std::make_shared<udev_device_watcher>(this);
+            }
+            catch (const std::exception& e)
+            {
+                LOG_WARNING("Hotplug events are unavailable, falling back to polling for devices. " << e.what());
+                return std::make_shared<polling_device_watcher>(this);
+            }
+        }
+
+        // Time to wait for the burst of uevents raised by a single (dis)connection to end before re-enumerating
+        const int UEVENT_SETTLE_TIME_MS = 50;
+
+        // Multicast group of the uevents that udev forwards once it has processed them, as libudev monitors do.
+        // Unlike the kernel group (1), its events arrive after the device nodes were created and given their permissions
+        const uint32_t UDEV_MONITOR_GROUP = 2;
+
+        // Header of the messages udev sends to its group, followed by the NUL separated KEY=VALUE properties of the uevent
+        struct udev_monitor_netlink_header
+        {
+            char prefix[8];             // "libudev"
+            uint32_t magic;             // UDEV_MONITOR_MAGIC, in network order
+            uint32_t header_size;
+            uint32_t properties_off;
+            uint32_t properties_len;
+        };
+        const uint32_t UDEV_MONITOR_MAGIC = 0xfeedcafe;
+
+        udev_device_watcher::udev_device_watcher(const backend* backend_ref)
+            : _backend(backend_ref), _stop_pipe_fd{}, _is_running(false)
+        {
+            // Without a running udev (e.g. in some containers) nothing is sent to its group
+            if (access("/run/udev/control", F_OK) < 0)
+                throw linux_backend_exception("udev_device_watcher: udev is not running");
+
+            _netlink_fd = socket(AF_NETLINK, SOCK_DGRAM | SOCK_CLOEXEC, NETLINK_KOBJECT_UEVENT);
+            if (_netlink_fd < 0)
+                throw linux_backend_exception("udev_device_watcher: socket(NETLINK_KOBJECT_UEVENT) failed");
+
+            sockaddr_nl addr{};
+            addr.nl_family = AF_NETLINK;
+            addr.nl_pid = 0;
+            addr.nl_groups = UDEV_MONITOR_GROUP;
+            // The credentials of the sender tell the messages of udev from forged ones
+            int pass_credentials = 1;
+            if (bind(_netlink_fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0 ||
+                setsockopt(_netlink_fd, SOL_SOCKET, SO_PASSCRED, &pass_credentials, sizeof(pass_credentials)) < 0)
+            {
+                ::close(_netlink_fd);
+                throw linux_backend_exception("udev_device_watcher: bind to the udev group failed");
+            }
+
+            if (pipe(_stop_pipe_fd) < 0)
+            {
+                ::close(_netlink_fd);
+                throw linux_backend_exception("udev_device_watcher: pipe() failed");
+            }
+        }
+
+        udev_device_watcher::~udev_device_watcher()
+        {
+            stop();
+            ::close(_stop_pipe_fd[0]);
+            ::close(_stop_pipe_fd[1]);
+            ::close(_netlink_fd);
+        }
+
+        void udev_device_watcher::start(device_changed_callback callback)
+        {
+            stop();
+
+            backend_device_group curr(_backend->query_uvc_devices(), _backend->query_usb_devices(), _backend->query_hid_devices());
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _callback = std::move(callback);
+                _devices_data = curr;
+            }
+
+            _is_running = true;
+            _thread = std::unique_ptr<std::thread>(new std::thread([this](){ watch_loop(); }));
+        }
+
+        void udev_device_watcher::stop()
+        {
+            if (!_thread)
+                return;
+
+            _is_running = false;
+            signal_stop();
+            _thread->join();
+            _thread.reset();
+
+            // Drain the stop signal so the watcher can be restarted
+            char buff[1];
+            fd_set fds{};
+            FD_ZERO(&fds);
+            FD_SET(_stop_pipe_fd[0], &fds);
+            timeval no_wait{};
+            while (select(_stop_pipe_fd[0] + 1, &fds, NULL, NULL, &no_wait) > 0 && read(_stop_pipe_fd[0], buff, 1) > 0) {}
+        }
+
+        bool udev_device_watcher::query_devices(backend_device_group& devices) const
+        {
+            if (!_is_running)
+                return false;
+
+            std::lock_guard<std::mutex> lock(_mutex);
+            devices = _devices_data;
+            return true;
+        }
+
+        void udev_device_watcher::signal_stop()
+        {
+            char buff[1] = {};
+            if (write(_stop_pipe_fd[1], buff, 1) < 0)
+            {
+                LOG_WARNING("udev_device_watcher: could not signal the watcher thread to stop");
+            }
+        }
+
+        void udev_device_watcher::watch_loop()
+        {
+            char buf[8192];
+            bool pending = false;
+            while (_is_running)
+            {
+                fd_set fds{};
+                FD_ZERO(&fds);
+                FD_SET(_netlink_fd, &fds);
+                FD_SET(_stop_pipe_fd[0], &fds);
+                int max_fd = std::max(_netlink_fd, _stop_pipe_fd[0]);
+
+                // Block until an event arrives, or wait for the current burst of events to settle
+                timeval settle = { 0, UEVENT_SETTLE_TIME_MS * 1000 };
+                int val = select(max_fd + 1, &fds, NULL, NULL, pending ? &settle : NULL);
+                if (val < 0)
+                {
+                    if (errno == EINTR)
+                        continue;
+                    LOG_ERROR("udev_device_watcher: select failed, errno=" << errno);
+                    break;
+                }
+
+                if (val == 0)
+                {
+                    pending = false;
+                    refresh_devices();
+                    continue;
+                }
+
+                if (FD_ISSET(_stop_pipe_fd[0], &fds))
+                    break;
+
+                if (FD_ISSET(_netlink_fd, &fds))
+                {
+                    iovec iov = { buf, sizeof(buf) };
+                    char control[CMSG_SPACE(sizeof(ucred))];
+                    sockaddr_nl sender{};
+                    msghdr msg{};
+                    msg.msg_name = &sender;
+                    msg.msg_namelen = sizeof(sender);
+                    msg.msg_iov = &iov;
+                    msg.msg_iovlen = 1;
+                    msg.msg_control = control;
+                    msg.msg_controllen = sizeof(control);
+
+                    auto len = recvmsg(_netlink_fd, &msg, MSG_DONTWAIT);
+                    if (len < 0 && errno == ENOBUFS)
+                    {
+                        // The socket overflowed and events were lost, all the devices are enumerated again
+                        LOG_WARNING("udev_device_watcher: uevents were lost, re-enumerating the devices");
+                        _uvc_changed = _usb_changed = _hid_changed = true;
+                        pending = true;
+                    }
+                    else if (len > 0)
+                    {
+                        // Only udev itself, running as root, sends to its group
+                        auto cmsg = CMSG_FIRSTHDR(&msg);
+                        if (!cmsg || cmsg->cmsg_type != SCM_CREDENTIALS || sender.nl_pid == 0 ||
+                            reinterpret_cast<ucred*>(CMSG_DATA(cmsg))->uid != 0)
+                            continue;
+
+                        handle_uevent(buf, len);
+                        pending = _uvc_changed || _usb_changed || _hid_changed;
+                    }
+                }
+            }
+        }
+
+        void udev_device_watcher::handle_uevent(const char* buf, ssize_t len)
+        {
+            udev_monitor_netlink_header header;
+            if (len < static_cast<ssize_t>(sizeof(header)))
+                return;
+            memcpy(&header, buf, sizeof(header));
+            if (strncmp(header.prefix, "libudev", sizeof(header.prefix)) != 0 || ntohl(header.magic) != UDEV_MONITOR_MAGIC ||
+                header.properties_off > static_cast<size_t>(len) || header.properties_len > static_cast<size_t>(len) - header.properties_off)
+            {
+                LOG_DEBUG("udev_device_watcher: ignoring a malformed udev message");
+                return;
+            }
+
+            std::string action, subsystem;
+            auto properties = buf + header.properties_off;
+            len = header.properties_len;
+            for (ssize_t i = 0; i < len; i += strnlen(properties + i, len - i) + 1)
+            {
+                std::string field(properties + i, strnlen(properties + i, len - i));
+                if (field.compare(0, 7, "ACTION=") == 0)
+                    action = field.substr(7);
+                else if (field.compare(0, 10, "SUBSYSTEM=") == 0)
+                    subsystem = field.substr(10);
+            }
+
+            if (action.empty() || action == "change")
+                return;
+
+            if (subsystem == "video4linux")
+                _uvc_changed = true;
+            else if (subsystem == "usb")
+                _usb_changed = true;
+            else if (subsystem == "iio")
+                _hid_changed = true;
+        }
+
+        void udev_device_watcher::refresh_devices()
+        {
+            backend_device_group curr;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                curr = _devices_data;
+            }
+
+            try
+            {
+                if (_uvc_changed) curr.uvc_devices = _backend->query_uvc_devices();
+                if (_usb_changed) curr.usb_devices = _backend->query_usb_devices();
+                if (_hid_changed) curr.hid_devices = _backend->query_hid_devices();
+            }
+            catch (const std::exception& e)
+            {
+                LOG_WARNING("udev_device_watcher: failed to query devices. " << e.what());
+                return;
+            }
+            _uvc_changed = _usb_changed = _hid_changed = false;
+
+            backend_device_group prev;
+            device_changed_callback callback;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                prev = _devices_data;
+                if (!list_changed(prev.uvc_devices, curr.uvc_devices) &&
+                    !list_changed(prev.usb_devices, curr.usb_devices) &&
+                    !list_changed(prev.hid_devices, curr.hid_devices))
+                    return;
+
+                _devices_data = curr;
+                callback = _callback;
+            }
+
+            if (callback)
+                callback(prev, curr);
         }
 
         std::shared_ptr<backend> create_backend()
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "backend.h"
+#include "backend-reactor.h"
 #include "types.h"
 
 #include <cassert>
@@ -75,7 +76,7 @@ namespace librealsense
         class buffer
         {
         public:
-            buffer(int fd, bool use_memory_map, int index);
+            buffer(int fd, bool use_memory_map, int index, bool export_dmabuf = false);
 
             void prepare_for_streaming(int fd);
 
@@ -85,22 +86,47 @@ namespace librealsense
 
             void detach_buffer();
 
-            void request_next_frame(int fd);
+            // Returns how long the buffer was held since attach_buffer(), or zero when it was not attached
+            std::chrono::steady_clock::duration request_next_frame(int fd);
 
             size_t get_full_length() const { return _length; }
             size_t get_length_frame_only() const { return _original_length; }
 
             uint8_t* get_frame_start() const { return _start; }
 
+            // DMABUF file descriptor of the buffer, -1 when it was not exported
+            int get_dmabuf_fd() const { return _dmabuf_fd; }
+
         private:
             uint8_t* _start;
             size_t _length;
             size_t _original_length;
             bool _use_memory_map;
             int _index;
+            int _dmabuf_fd = -1;
             v4l2_buffer _buf;
             std::mutex _mutex;
             bool _must_enqueue = false;
+            std::chrono::steady_clock::time_point _attach_time;
+        };
+
+        // Tracks how long the application holds the frame buffers of a stream, and the frames dropped by the kernel
+        class capture_monitor
+        {
+        public:
+            void reset(uint32_t buffers);
+
+            // Returns the number of frames dropped right before this one
+            uint32_t on_frame(uint32_t sequence);
+
+            void on_buffer_released(std::chrono::steady_clock::duration hold_time);
+
+            capture_statistics get_statistics() const;
+
+        private:
+            mutable std::mutex _mutex;
+            capture_statistics _stats;
+            uint32_t _last_sequence = 0;
         };
 
         class v4l_usb_device : public usb_device
@@ -173,12 +199,20 @@ namespace librealsense
 
             std::string get_device_location() const override { return _device_path; }
             usb_spec get_usb_specification() const override { return _device_usb_spec; }
+            capture_statistics get_capture_statistics() const override { return _monitor->get_statistics(); }
+
+            bool supports_dmabuf_export() const override { return true; }
+            void set_dmabuf_export(bool enable) override;
 
         private:
             static uint32_t get_cid(rs2_option option);
 
             void capture_loop();
 
+            void dequeue_frame();
+
+            void notify_frames_timeout();
+
             bool has_metadata();
 
             power_state _state = D3;
@@ -190,14 +224,51 @@ namespace librealsense
             int _stop_pipe_fd[2]; // write to _stop_pipe_fd[1] and read from _stop_pipe_fd[0]
 
             std::vector<std::shared_ptr<buffer>> _buffers;
+            std::shared_ptr<capture_monitor> _monitor; // Shared with the frame continuations, which may outlive the device
             stream_profile _profile;
             frame_callback _callback;
             std::atomic<bool> _is_capturing;
             std::atomic<bool> _is_alive;
             std::atomic<bool> _is_started;
             std::unique_ptr<std::thread> _thread;
+            std::shared_ptr<capture_reactor> _reactor; // Replaces the capture thread when the backend is built with the reactor
             std::unique_ptr<named_mutex> _named_mtx;
             bool _use_memory_map;
+            bool _memory_map_requested; // As given to the constructor, the stream is memory mapped also when exporting DMABUFs
+            bool _export_dmabuf = false;
+        };
+
+        // Device watcher driven by the uevents that udev forwards over a netlink socket once it has processed them.
+        // Only the device lists of the subsystems that reported an event are queried again.
+        class udev_device_watcher : public device_watcher
+        {
+        public:
+            explicit udev_device_watcher(const backend* backend_ref);
+            ~udev_device_watcher();
+
+            void start(device_changed_callback callback) override;
+            void stop() override;
+            bool query_devices(backend_device_group& devices) const override;
+
+        private:
+            void watch_loop();
+            void handle_uevent(const char* buf, ssize_t len);
+            void refresh_devices();
+            void signal_stop();
+
+            const backend* _backend;
+            int _netlink_fd = -1;
+            int _stop_pipe_fd[2];
+            std::unique_ptr<std::thread> _thread;
+            std::atomic<bool> _is_running;
+
+            mutable std::mutex _mutex;
+            backend_device_group _devices_data;
+            device_changed_callback _callback;
+
+            bool _uvc_changed = false;
+            bool _usb_changed = false;
+            bool _hid_changed = false;
         };
 
         class v4l_backend : public backend
@@ -3,6 +3,7 @@
 
 #include <cmath>
 #include "playback_device.h"
+#include "read_ahead_reader.h"
 #include "core/motion.h"
 #include "stream.h"
 #include "media/ros/ros_reader.h"
@@ -25,7 +26,9 @@ playback_device::playback_device(std::shared_ptr<context> ctx, std::shared_ptr<d
         throw invalid_value_exception("null serializer");
     }
 
-    m_reader = serializer;
+    //Reading, decompressing and deserializing the file is done ahead of the playback on a separate thread
+    m_read_ahead = std::make_shared<read_ahead_reader>(serializer);
+    m_reader = m_read_ahead;
     (*m_read_thread)->start();
 
     //Read header and build device from recorded device snapshot
@@ -332,6 +335,22 @@ bool playback_device::is_real_time() const
     return m_real_time;
 }
 
+void playback_device::set_read_ahead(size_t max_frames, size_t max_bytes)
+{
+    LOG_INFO("Set read ahead to " << max_frames << " frames, " << max_bytes << " bytes");
+    m_read_ahead->set_limits(max_frames, max_bytes);
+}
+
+size_t playback_device::get_read_ahead_frames() const
+{
+    return m_read_ahead->get_max_frames();
+}
+
+size_t playback_device::get_read_ahead_bytes() const
+{
+    return m_read_ahead->get_max_bytes();
+}
+
 platform::backend_device_group playback_device::get_device_data() const
 {
     return platform::backend_device_group({ platform::playback_device_info{ m_reader->get_file_name() } });
@@ -564,6 +583,149 @@ void playback_device::try_looping()
     do_loop(read_action);
 }
 
+device_serializer::stream_identifier playback_device::find_stream(const stream_profile_interface& profile, std::shared_ptr<playback_sensor>& sensor, std::shared_ptr<stream_profile_interface>& stream) const
+{
+    for (auto&& sensor_pair : m_sensors)
+    {
+        for (auto&& p : sensor_pair.second->get_stream_profiles())
+        {
+            if (p->get_unique_id() == profile.get_unique_id())
+            {
+                sensor = sensor_pair.second;
+                stream = p;
+                return { get_device_index(), sensor_pair.first, p->get_stream_type(), static_cast<uint32_t>(p->get_stream_index()) };
+            }
+        }
+    }
+    throw invalid_value_exception("Stream profile does not belong to the playback device");
+}
+
+template <typename T>
+auto playback_device::with_cursor(T action) -> decltype(action(std::declval<ros_reader&>()))
+{
+    //Random access reads go through readers of their own, so that they do not move the playback,
+    // and concurrent calls neither share a file position nor wait for one another
+    std::shared_ptr<ros_reader> cursor;
+    {
+        std::lock_guard<std::mutex> lock(m_cursors_mutex);
+        if (!m_cursors.empty())
+        {
+            cursor = m_cursors.back();
+            m_cursors.pop_back();
+        }
+    }
+    if (cursor == nullptr)
+    {
+        cursor = make_cursor();
+    }
+
+    //The cursor is returned only once the action is done with what it read, since its frames are attached to it
+    auto release = [this, &cursor]()
+    {
+        std::lock_guard<std::mutex> lock(m_cursors_mutex);
+        if (m_cursors.size() < MAX_IDLE_CURSORS)
+        {
+            m_cursors.push_back(cursor);
+        }
+    };
+    try
+    {
+        auto result = action(*cursor);
+        release();
+        return result;
+    }
+    catch (...)
+    {
+        release();
+        throw;
+    }
+}
+
+std::shared_ptr<ros_reader> playback_device::make_cursor()
+{
+    //The frame index is built once, by the index cursor, and shared by all the cursors
+    auto cursor = std::make_shared<ros_reader>(get_file_name(), m_context, index_cursor().get_shared_frame_index());
+    //The application decides how many of the frames it reads to keep, as with frames it allocates itself
+    cursor->set_frame_pool_size(0);
+    return cursor;
+}
+
+ros_reader& playback_device::index_cursor()
+{
+    //Lookups only read the index, frame numbers are added to it under m_frame_numbers_mutex
+    std::call_once(m_index_cursor_flag, [this]()
+    {
+        m_index_cursor = std::make_shared<ros_reader>(get_file_name(), m_context);
+    });
+    return *m_index_cursor;
+}
+
+uint64_t playback_device::get_frame_count(const stream_profile_interface& profile)
+{
+    std::shared_ptr<playback_sensor> sensor;
+    std::shared_ptr<stream_profile_interface> stream;
+    auto stream_id = find_stream(profile, sensor, stream);
+
+    return index_cursor().query_frame_count(stream_id);
+}
+
+frame_holder playback_device::get_frame(const stream_profile_interface& profile, uint64_t position)
+{
+    std::shared_ptr<playback_sensor> sensor;
+    std::shared_ptr<stream_profile_interface> stream;
+    auto stream_id = find_stream(profile, sensor, stream);
+
+    return with_cursor([&](ros_reader& reader)
+    {
+        auto data = reader.read_frame(stream_id, static_cast<size_t>(position));
+        if (data->is<serialized_invalid_frame>() || data->frame == nullptr)
+        {
+            throw io_exception(to_string() << "Failed to read frame " << position << " of stream " << stream_id);
+        }
+
+        //Attaching the frame to the recorded stream, as the playback sensor does for the frames it plays
+        frame_holder frame = std::move(data->frame);
+        frame->get_owner()->set_sensor(sensor);
+        frame->set_stream(stream);
+        frame->set_sensor(sensor);
+        return frame;
+    });
+}
+
+device_serializer::nanoseconds playback_device::get_frame_time(const stream_profile_interface& profile, uint64_t position)
+{
+    std::shared_ptr<playback_sensor> sensor;
+    std::shared_ptr<stream_profile_interface> stream;
+    auto stream_id = find_stream(profile, sensor, stream);
+
+    return index_cursor().query_frame_time(stream_id, static_cast<size_t>(position));
+}
+
+uint64_t playback_device::find_frame(const stream_profile_interface& profile, device_serializer::nanoseconds time)
+{
+    std::shared_ptr<playback_sensor> sensor;
+    std::shared_ptr<stream_profile_interface> stream;
+    auto stream_id = find_stream(profile, sensor, stream);
+
+    return index_cursor().find_frame(stream_id, time);
+}
+
+uint64_t playback_device::find_frame_number(const stream_profile_interface& profile, uint64_t frame_number)
+{
+    std::shared_ptr<playback_sensor> sensor;
+    std::shared_ptr<stream_profile_interface> stream;
+    auto stream_id = find_stream(profile, sensor, stream);
+
+    //Loading the frame numbers of a stream reads all its messages, the cursors are not held meanwhile
+    std::lock_guard<std::mutex> lock(m_frame_numbers_mutex);
+    size_t position = 0;
+    if (!index_cursor().find_frame_number(stream_id, frame_number, position))
+    {
+        return index_cursor().query_frame_count(stream_id);
+    }
+    return position;
+}
+
 const std::string& playback_device::get_file_name() const
 {
     return m_reader->get_file_name();
@@ -14,11 +14,16 @@
 
 namespace librealsense
 {
+    class read_ahead_reader;
+    class ros_reader;
+
     class playback_device : public device_interface,
                             public extendable_interface,
                             public info_container
     {
     public:
+        static const size_t MAX_IDLE_CURSORS = 4; // Readers kept open for random access once their calls return
+
         playback_device(std::shared_ptr<context> context, std::shared_ptr<device_serializer::reader> serializer);
         virtual ~playback_device();
 
@@ -40,6 +45,14 @@ namespace librealsense
         void stop();
         void set_real_time(bool real_time);
         bool is_real_time() const;
+        void set_read_ahead(size_t max_frames, size_t max_bytes);
+        size_t get_read_ahead_frames() const;
+        size_t get_read_ahead_bytes() const;
+        uint64_t get_frame_count(const stream_profile_interface& profile);
+        frame_holder get_frame(const stream_profile_interface& profile, uint64_t position);
+        device_serializer::nanoseconds get_frame_time(const stream_profile_interface& profile, uint64_t position);
+        uint64_t find_frame(const stream_profile_interface& profile, device_serializer::nanoseconds time);
+        uint64_t find_frame_number(const stream_profile_interface& profile, uint64_t frame_number);
         const std::string& get_file_name() const;
         uint64_t get_position() const;
         signal<playback_device, rs2_playback_status> playback_status_changed;
@@ -69,10 +82,15 @@ namespace librealsense
         void register_device_info(const device_serializer::device_snapshot& device_description);
         void register_extrinsics(const device_serializer::device_snapshot& device_description);
         void update_extensions(const device_serializer::device_snapshot& device_description);
+        device_serializer::stream_identifier find_stream(const stream_profile_interface& profile, std::shared_ptr<playback_sensor>& sensor, std::shared_ptr<stream_profile_interface>& stream) const;
+        template <typename T> auto with_cursor(T action) -> decltype(action(std::declval<ros_reader&>()));
+        ros_reader& index_cursor();
+        std::shared_ptr<ros_reader> make_cursor();
 
     private:
         lazy<std::shared_ptr<dispatcher>> m_read_thread;
         std::shared_ptr<device_serializer::reader> m_reader;
+        std::shared_ptr<read_ahead_reader> m_read_ahead;
         device_serializer::device_snapshot m_device_description;
         std::atomic_bool m_is_started;
         std::atomic_bool m_is_paused;
@@ -86,6 +104,11 @@ namespace librealsense
         std::shared_ptr<context> m_context;
         std::vector<std::shared_ptr<lazy<rs2_extrinsics>>> m_extrinsics_fetchers;
         std::map<int, std::pair<uint32_t, rs2_extrinsics>> m_extrinsics_map;
+        std::mutex m_cursors_mutex;
+        std::vector<std::shared_ptr<ros_reader>> m_cursors; // Idle readers of the file for random access, at most MAX_IDLE_CURSORS
+        std::once_flag m_index_cursor_flag;
+        std::shared_ptr<ros_reader> m_index_cursor;        // Reader whose frame index serves the lookups, and is shared by the cursors
+        std::mutex m_frame_numbers_mutex;                   // Serializes the loading of frame numbers, through the index cursor
 
     };
 
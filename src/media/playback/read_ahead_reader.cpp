@@ -0,0 +1,223 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2017 Intel Corporation. All Rights Reserved.
+
+#include <algorithm>
+#include "read_ahead_reader.h"
+#include "archive.h"
+
+using namespace librealsense;
+using namespace librealsense::device_serializer;
+
+read_ahead_reader::read_ahead_reader(std::shared_ptr<reader> reader, size_t max_frames, size_t max_bytes) :
+    m_reader(reader),
+    m_queued_bytes(0),
+    m_max_frames(max_frames),
+    m_max_bytes(max_bytes),
+    m_halted(false),
+    m_stopping(false)
+{
+    if (reader == nullptr)
+    {
+        throw invalid_value_exception("null serializer");
+    }
+    m_thread = std::thread([this]() { run(); });
+}
+
+read_ahead_reader::~read_ahead_reader()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_cv.notify_all();
+    m_thread.join();
+}
+
+void read_ahead_reader::set_limits(size_t max_frames, size_t max_bytes)
+{
+    if (max_frames > READ_AHEAD_MAX_FRAMES)
+    {
+        throw invalid_value_exception(to_string() << "Read ahead of " << max_frames << " frames exceeds the maximum of " << READ_AHEAD_MAX_FRAMES);
+    }
+    {
+        //Frames that were already read are still delivered first, in order
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_max_frames = max_frames;
+        m_max_bytes = max_bytes;
+    }
+    m_cv.notify_all();
+}
+
+size_t read_ahead_reader::get_max_frames() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_max_frames;
+}
+
+size_t read_ahead_reader::get_max_bytes() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_max_bytes;
+}
+
+bool read_ahead_reader::has_room() const
+{
+    //A single item is always allowed, so that a frame larger than the byte limit does not stall playback
+    return m_queue.empty() || (m_queue.size() < m_max_frames && m_queued_bytes < m_max_bytes);
+}
+
+void read_ahead_reader::clear()
+{
+    m_queue.clear();
+    m_queued_bytes = 0;
+    m_halted = false;
+}
+
+void read_ahead_reader::run()
+{
+    while (true)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [this]() { return m_stopping || (m_max_frames > 0 && !m_halted && has_room()); });
+        if (m_stopping)
+            return;
+        lock.unlock();
+
+        //The queue may have changed while waiting for the reader, in which case the conditions are checked again
+        std::lock_guard<std::mutex> reader_lock(m_reader_mutex);
+        lock.lock();
+        if (m_stopping || m_max_frames == 0 || m_halted || !has_room())
+            continue;
+        lock.unlock();
+
+        read_ahead_item item{ nullptr, nullptr, 0 };
+        try
+        {
+            item.data = m_reader->read_next_data();
+            auto f = item.data ? item.data->as<serialized_frame>() : nullptr;
+            if (f)
+            {
+                if (auto data_frame = dynamic_cast<librealsense::frame*>(f->frame.frame))
+                    item.size = data_frame->data.size();
+            }
+        }
+        catch (...)
+        {
+            item.error = std::current_exception();
+        }
+
+        lock.lock();
+        if (item.error || (item.data && item.data->is<serialized_end_of_file>()))
+        {
+            //Nothing more to read until the reader is moved, read_next_data() will call the reader directly meanwhile
+            m_halted = true;
+        }
+        m_queued_bytes += item.size;
+        m_queue.push_back(std::move(item));
+        lock.unlock();
+        m_cv.notify_all();
+    }
+}
+
+std::shared_ptr<serialized_data> read_ahead_reader::read_next_data()
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [this]() { return !m_queue.empty() || m_halted || m_max_frames == 0; });
+        if (!m_queue.empty())
+        {
+            auto item = std::move(m_queue.front());
+            m_queue.pop_front();
+            m_queued_bytes -= item.size;
+            lock.unlock();
+            m_cv.notify_all();
+
+            if (item.error)
+                std::rethrow_exception(item.error);
+            return item.data;
+        }
+    }
+    std::lock_guard<std::mutex> reader_lock(m_reader_mutex);
+    return m_reader->read_next_data();
+}
+
+device_snapshot read_ahead_reader::query_device_description(const nanoseconds& time)
+{
+    std::lock_guard<std::mutex> reader_lock(m_reader_mutex);
+    return m_reader->query_device_description(time);
+}
+
+void read_ahead_reader::seek_to_time(const nanoseconds& time)
+{
+    std::lock_guard<std::mutex> reader_lock(m_reader_mutex);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        clear();
+    }
+    m_reader->seek_to_time(time);
+    m_cv.notify_all();
+}
+
+nanoseconds read_ahead_reader::query_duration() const
+{
+    return m_reader->query_duration();
+}
+
+void read_ahead_reader::reset()
+{
+    std::lock_guard<std::mutex> reader_lock(m_reader_mutex);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        clear();
+    }
+    m_reader->reset();
+    m_cv.notify_all();
+}
+
+void read_ahead_reader::enable_stream(const std::vector<stream_identifier>& stream_ids)
+{
+    std::lock_guard<std::mutex> reader_lock(m_reader_mutex);
+    {
+        //Data already read is kept, the new streams are read from where the reader is (at most the read ahead further).
+        //An end of file (or failure) is dropped though, since the reader has new data to read
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_halted && !m_queue.empty())
+        {
+            m_queued_bytes -= m_queue.back().size;
+            m_queue.pop_back();
+        }
+        m_halted = false;
+    }
+    m_reader->enable_stream(stream_ids);
+    m_cv.notify_all();
+}
+
+void read_ahead_reader::disable_stream(const std::vector<stream_identifier>& stream_ids)
+{
+    std::lock_guard<std::mutex> reader_lock(m_reader_mutex);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto disabled = [&stream_ids](const read_ahead_item& item)
+        {
+            auto f = item.data ? item.data->as<serialized_frame>() : nullptr;
+            return f && std::find(stream_ids.begin(), stream_ids.end(), f->stream_id) != stream_ids.end();
+        };
+        m_queue.erase(std::remove_if(m_queue.begin(), m_queue.end(), disabled), m_queue.end());
+        m_queued_bytes = 0;
+        for (auto&& item : m_queue)
+            m_queued_bytes += item.size;
+    }
+    m_reader->disable_stream(stream_ids);
+    m_cv.notify_all();
+}
+
+const std::string& read_ahead_reader::get_file_name() const
+{
+    return m_reader->get_file_name();
+}
+
+std::vector<std::shared_ptr<serialized_data>> read_ahead_reader::fetch_last_frames(const nanoseconds& seek_time)
+{
+    std::lock_guard<std::mutex> reader_lock(m_reader_mutex);
+    return m_reader->fetch_last_frames(seek_time);
+}
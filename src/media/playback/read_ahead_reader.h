@@ -0,0 +1,70 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2017 Intel Corporation. All Rights Reserved.
+
+#pragma once
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <core/serialization.h>
+
+namespace librealsense
+{
+    // Frame pool of a ros_reader is 32 frames, the read ahead queue must leave enough of it to the sensors
+    const size_t READ_AHEAD_DEFAULT_FRAMES = 8;
+    const size_t READ_AHEAD_MAX_FRAMES = 16;
+    const size_t READ_AHEAD_DEFAULT_BYTES = 64 * 1024 * 1024;
+
+    // Wraps a reader with a thread that reads (and so decompresses and deserializes) the upcoming data
+    // ahead of the playback, into a queue bounded both in number of frames and in bytes.
+    // read_next_data() only waits for the thread when the queue runs empty, so that slow storage
+    // does not delay the delivery of frames that were already read.
+    class read_ahead_reader : public device_serializer::reader
+    {
+    public:
+        read_ahead_reader(std::shared_ptr<device_serializer::reader> reader,
+                          size_t max_frames = READ_AHEAD_DEFAULT_FRAMES,
+                          size_t max_bytes = READ_AHEAD_DEFAULT_BYTES);
+        ~read_ahead_reader();
+
+        // max_frames of 0 disables the read ahead, data is then read on the calling thread
+        void set_limits(size_t max_frames, size_t max_bytes);
+        size_t get_max_frames() const;
+        size_t get_max_bytes() const;
+
+        device_serializer::device_snapshot query_device_description(const device_serializer::nanoseconds& time) override;
+        std::shared_ptr<device_serializer::serialized_data> read_next_data() override;
+        void seek_to_time(const device_serializer::nanoseconds& time) override;
+        device_serializer::nanoseconds query_duration() const override;
+        void reset() override;
+        void enable_stream(const std::vector<device_serializer::stream_identifier>& stream_ids) override;
+        void disable_stream(const std::vector<device_serializer::stream_identifier>& stream_ids) override;
+        const std::string& get_file_name() const override;
+        std::vector<std::shared_ptr<device_serializer::serialized_data>> fetch_last_frames(const device_serializer::nanoseconds& seek_time) override;
+
+    private:
+        struct read_ahead_item
+        {
+            std::shared_ptr<device_serializer::serialized_data> data;
+            std::exception_ptr error;
+            size_t size;
+        };
+
+        void run();
+        bool has_room() const;
+        void clear(); // Requires m_mutex
+
+        std::shared_ptr<device_serializer::reader> m_reader;
+        std::mutex m_reader_mutex;                  // Serializes the calls to m_reader, always locked before m_mutex
+
+        mutable std::mutex m_mutex;
+        std::condition_variable m_cv;
+        std::deque<read_ahead_item> m_queue;
+        size_t m_queued_bytes;
+        size_t m_max_frames;
+        size_t m_max_bytes;
+        bool m_halted;                              // The reader reached the end of the file, or failed, until the next seek or reset
+        bool m_stopping;
+        std::thread m_thread;
+    };
+}
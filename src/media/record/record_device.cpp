@@ -12,7 +12,8 @@ librealsense::record_device::record_device(std::shared_ptr<librealsense::device_
                                       std::shared_ptr<librealsense::device_serializer::writer> serializer):
     m_write_thread([](){return std::make_shared<dispatcher>(std::numeric_limits<unsigned int>::max());}),
     m_is_recording(true),
-    m_record_pause_time(0)
+    m_record_pause_time(0),
+    m_write_buffer(std::make_shared<record_write_buffer>(MAX_CACHED_DATA_SIZE))
 {
     if (device == nullptr)
     {
@@ -50,6 +51,8 @@ std::vector<std::shared_ptr<librealsense::record_sensor>> librealsense::record_d
 
 librealsense::record_device::~record_device()
 {
+    //Sensor callbacks waiting for room in the write buffer must not outlive the device
+    m_write_buffer->stop();
     for (auto&& s : m_sensors)
     {
         s->on_notification -= m_on_notification_token;
@@ -121,21 +124,29 @@ void librealsense::record_device::write_data(size_t sensor_index, librealsense::
         initialize_recording();
     });
 
-    //TODO: restore: uint64_t data_size = frame.frame->get_frame_data_size();
-    uint64_t cached_data_size = m_cached_data_size; //TODO: restore: (+ data_size)
-    if (cached_data_size > MAX_CACHED_DATA_SIZE)
+    const uint32_t device_index = 0;
+    auto stream_type = frame.frame->get_stream()->get_stream_type();
+    auto stream_index = static_cast<uint32_t>(frame.frame->get_stream()->get_stream_index());
+    device_serializer::stream_identifier stream_id{ device_index, static_cast<uint32_t>(sensor_index), stream_type, stream_index };
+    //The buffer is held by the callback, that could be waiting for room while the device is destroyed
+    auto write_buffer = m_write_buffer;
+    auto reservation = write_buffer->reserve(stream_id, frame.frame->get_frame_data_size());
+    if (reservation == nullptr)
     {
-        LOG_WARNING("Recorder reached maximum cache size, frame dropped");
-        on_error("Recorder reached maximum cache size, frame dropped");
-        return;
+        if (write_buffer->get_overflow_policy() == RS2_RECORD_OVERFLOW_STOP)
+        {
+            LOG_WARNING("Recorder reached maximum cache size, frame dropped");
+            on_error("Recorder reached maximum cache size, frame dropped");
+        }
+        return; //Dropped, the sensor keeps streaming
     }
 
-    m_cached_data_size = cached_data_size;
     auto capture_time = get_capture_time();
     //TODO: remove usage of shared pointer when frame_holder is copyable
     auto frame_holder_ptr = std::make_shared<frame_holder>();
     *frame_holder_ptr = std::move(frame);
-    (*m_write_thread)->invoke([this, frame_holder_ptr, sensor_index, capture_time/*, data_size*/, on_error](dispatcher::cancellable_timer t) {
+    //The reservation is given back when the task is done, or discarded by the write thread
+    (*m_write_thread)->invoke([this, frame_holder_ptr, stream_id, capture_time, reservation, on_error](dispatcher::cancellable_timer t) {
         if (m_is_recording == false)
         {
             return; //Recording is paused
@@ -155,11 +166,7 @@ void librealsense::record_device::write_data(size_t sensor_index, librealsense::
 
         try
         {
-            const uint32_t device_index = 0;
-            auto stream_type = frame_holder_ptr->frame->get_stream()->get_stream_type();
-            auto stream_index = static_cast<uint32_t>(frame_holder_ptr->frame->get_stream()->get_stream_index());
-            m_ros_writer->write_frame({ device_index, static_cast<uint32_t>(sensor_index), stream_type, stream_index }, capture_time, std::move(*frame_holder_ptr));
-            //TODO: restore: std::lock_guard<std::mutex> locker(m_mutex);  m_cached_data_size -= data_size;
+            m_ros_writer->write_frame(stream_id, capture_time, std::move(*frame_holder_ptr));
         }
         catch(std::exception& e)
         {
@@ -168,6 +175,21 @@ void librealsense::record_device::write_data(size_t sensor_index, librealsense::
     });
 }
 
+void librealsense::record_device::set_write_buffer(uint64_t max_bytes, rs2_record_overflow_policy policy)
+{
+    m_write_buffer->set_size(max_bytes, policy);
+}
+
+uint64_t librealsense::record_device::get_dropped_frames(const stream_profile_interface& profile) const
+{
+    return m_write_buffer->get_dropped_frames(profile.get_stream_type(), profile.get_stream_index());
+}
+
+uint64_t librealsense::record_device::get_buffered_bytes() const
+{
+    return m_write_buffer->get_buffered_bytes();
+}
+
 const std::string& librealsense::record_device::get_info(rs2_camera_info info) const
 {
     return m_device->get_info(info);
@@ -399,6 +421,15 @@ void librealsense::record_device::resume_recording()
     });
 }
 
+void librealsense::record_device::set_rotation(uint64_t max_bytes, std::chrono::nanoseconds max_duration)
+{
+    //Applied by the write thread, from the next frame on
+    (*m_write_thread)->invoke([this, max_bytes, max_duration](dispatcher::cancellable_timer c)
+    {
+        m_ros_writer->set_rotation(max_bytes, max_duration);
+    });
+}
+
 const std::string& librealsense::record_device::get_filename() const
 {
     return m_ros_writer->get_file_name();
@@ -416,7 +447,6 @@ void record_device::initialize_recording()
 {
     //Expected to be called once when recording to file actually starts
     m_capture_time_base = std::chrono::high_resolution_clock::now();
-    m_cached_data_size = 0;
 }
 void record_device::stop_gracefully(to_string error_msg)
 {
@@ -10,6 +10,7 @@
 #include "concurrency.h"
 #include "sensor.h"
 #include "record_sensor.h"
+#include "record_write_buffer.h"
 
 namespace librealsense
 {
@@ -18,7 +19,7 @@ namespace librealsense
                           public info_container
     {
     public:
-        static const uint64_t MAX_CACHED_DATA_SIZE = 1920 * 1080 * 4 * 30; // ~1 sec of HD video @ 30 FPS
+        static const uint64_t MAX_CACHED_DATA_SIZE = 1920 * 1080 * 4 * 30; // ~1 sec of HD video @ 30 FPS, default size of the write buffer
 
         record_device(std::shared_ptr<device_interface> device, std::shared_ptr<device_serializer::writer> serializer);
         virtual ~record_device();
@@ -38,7 +39,12 @@ namespace librealsense
 
         void pause_recording();
         void resume_recording();
+        void set_rotation(uint64_t max_bytes, std::chrono::nanoseconds max_duration);
         const std::string& get_filename() const;
+        // Frames wait in the write buffer from the sensor callback until they are written, max_bytes of 0 restores the default size
+        void set_write_buffer(uint64_t max_bytes, rs2_record_overflow_policy policy);
+        uint64_t get_dropped_frames(const stream_profile_interface& profile) const;
+        uint64_t get_buffered_bytes() const;
         platform::backend_device_group get_device_data() const override;
         std::pair<uint32_t, rs2_extrinsics> get_extrinsics(const stream_interface& stream) const override;
         bool is_valid() const override;
@@ -69,12 +75,13 @@ namespace librealsense
         std::chrono::high_resolution_clock::time_point m_time_of_pause;
 
         std::mutex m_mutex;
+        std::shared_ptr<record_write_buffer> m_write_buffer;
+
         bool m_is_recording;
         std::once_flag m_first_frame_flag;
         int m_on_notification_token;
         int m_on_frame_token;
         int m_on_extension_change_token;
-        uint64_t m_cached_data_size;
         std::once_flag m_first_call_flag;
         void initialize_recording();
         void stop_gracefully(to_string error_msg);
@@ -0,0 +1,108 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2017 Intel Corporation. All Rights Reserved.
+
+#include "record_write_buffer.h"
+
+using namespace librealsense;
+
+record_write_buffer::reservation::reservation(std::shared_ptr<record_write_buffer> buffer, uint64_t size) :
+    _buffer(buffer), _size(size)
+{
+}
+
+record_write_buffer::reservation::~reservation()
+{
+    _buffer->release(_size);
+}
+
+record_write_buffer::record_write_buffer(uint64_t default_size) :
+    _default_size(default_size), _max_size(default_size)
+{
+}
+
+std::shared_ptr<record_write_buffer::reservation> record_write_buffer::reserve(const device_serializer::stream_identifier& stream_id, uint64_t size)
+{
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        auto fits = [this, size]() { return _size == 0 || _size + size <= _max_size; };
+        if (!_is_stopped && !fits() && _policy == RS2_RECORD_OVERFLOW_BLOCK)
+        {
+            //Holds the sensor callback until the write thread catches up
+            _cv.wait(lock, [this, &fits]() { return fits() || _policy != RS2_RECORD_OVERFLOW_BLOCK || _is_stopped; });
+        }
+        if (_is_stopped)
+        {
+            return nullptr;
+        }
+        if (!fits())
+        {
+            _dropped_frames[stream_id]++;
+            if (!_is_dropping)
+            {
+                LOG_WARNING("Recorder write buffer of " << _max_size << " bytes is full, dropping frames (first of stream " << stream_id << ")");
+                _is_dropping = true;
+            }
+            return nullptr;
+        }
+        _size += size;
+    }
+    return std::make_shared<reservation>(shared_from_this(), size);
+}
+
+void record_write_buffer::release(uint64_t size)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _size -= size;
+        if (_size == 0 && _is_dropping)
+        {
+            LOG_INFO("Recorder write buffer caught up");
+            _is_dropping = false;
+        }
+    }
+    _cv.notify_all();
+}
+
+void record_write_buffer::set_size(uint64_t max_bytes, rs2_record_overflow_policy policy)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _max_size = max_bytes ? max_bytes : _default_size;
+        _policy = policy;
+    }
+    //Blocked callbacks check the new limit, and drop their frame if no longer allowed to wait
+    _cv.notify_all();
+}
+
+rs2_record_overflow_policy record_write_buffer::get_overflow_policy() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _policy;
+}
+
+uint64_t record_write_buffer::get_dropped_frames(rs2_stream stream_type, int stream_index) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    uint64_t dropped = 0;
+    for (auto&& kvp : _dropped_frames)
+    {
+        if (kvp.first.stream_type == stream_type && kvp.first.stream_index == static_cast<uint32_t>(stream_index))
+            dropped += kvp.second;
+    }
+    return dropped;
+}
+
+uint64_t record_write_buffer::get_buffered_bytes() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _size;
+}
+
+void record_write_buffer::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _is_stopped = true;
+    }
+    _cv.notify_all();
+}
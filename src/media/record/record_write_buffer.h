@@ -0,0 +1,63 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2017 Intel Corporation. All Rights Reserved.
+
+#pragma once
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <core/serialization.h>
+
+namespace librealsense
+{
+    // Bounds in bytes the frames that a record device holds between the sensor callbacks and the write thread.
+    // A queued frame holds a reservation of its size, which is given back when the reservation is destroyed: once the
+    // write thread is done with the frame, or when the frame is discarded along with the queue of the write thread.
+    class record_write_buffer : public std::enable_shared_from_this<record_write_buffer>
+    {
+    public:
+        class reservation
+        {
+        public:
+            reservation(std::shared_ptr<record_write_buffer> buffer, uint64_t size);
+            ~reservation();
+
+            reservation(const reservation&) = delete;
+            reservation& operator=(const reservation&) = delete;
+
+        private:
+            std::shared_ptr<record_write_buffer> _buffer;
+            uint64_t _size;
+        };
+
+        explicit record_write_buffer(uint64_t default_size);
+
+        // A frame is always accepted into an empty buffer, so that a frame larger than the buffer does not stall the recording.
+        // Returns null when the frame does not fit, and counts it as dropped for its stream
+        std::shared_ptr<reservation> reserve(const device_serializer::stream_identifier& stream_id, uint64_t size);
+
+        // max_bytes of 0 restores the default size
+        void set_size(uint64_t max_bytes, rs2_record_overflow_policy policy);
+        rs2_record_overflow_policy get_overflow_policy() const;
+
+        // Streams are identified by type and index, which are unique across the sensors of a device
+        uint64_t get_dropped_frames(rs2_stream stream_type, int stream_index) const;
+        uint64_t get_buffered_bytes() const;
+
+        // Wakes the callbacks waiting for room, and refuses frames from then on
+        void stop();
+
+    private:
+        void release(uint64_t size);
+
+        mutable std::mutex _mutex;
+        std::condition_variable _cv;
+        const uint64_t _default_size;
+        uint64_t _max_size;
+        uint64_t _size = 0;
+        rs2_record_overflow_policy _policy = RS2_RECORD_OVERFLOW_STOP;
+        std::map<device_serializer::stream_identifier, uint64_t> _dropped_frames;
+        bool _is_dropping = false; // Frames were dropped since the buffer was last empty
+        bool _is_stopped = false;
+    };
+}
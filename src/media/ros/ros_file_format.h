@@ -191,6 +191,8 @@ namespace librealsense
     constexpr const char* MAPPER_CONFIDENCE_MD_STR = "Mapper Confidence";
     constexpr const char* FRAME_TIMESTAMP_MD_STR = "frame_timestamp";
     constexpr const char* TRACKER_CONFIDENCE_MD_STR = "Tracker Confidence";
+    // Prefixes the encoding of images whose data is RVL encoded, for example "rvl/mono16"
+    constexpr const char* RVL_IMAGE_ENCODING_PREFIX = "rvl/";
 
     class ros_topic
     {
@@ -0,0 +1,246 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2017 Intel Corporation. All Rights Reserved.
+
+#include "ros_frame_index.h"
+#include "file-utils.h"
+#include "types.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+
+namespace librealsense
+{
+    using namespace device_serializer;
+
+    const uint32_t FRAME_INDEX_SIDECAR_MAGIC = 0x49465352; // "RSFI"
+    const uint32_t FRAME_INDEX_SIDECAR_VERSION = 1;
+
+    void ros_frame_index::add(const stream_identifier& stream_id, const std::string& topic, nanoseconds time)
+    {
+        auto& stream = m_streams[stream_id];
+        if (stream.frames.empty())
+            stream.topic = topic;
+        stream.frames.push_back({ time, 0 });
+        stream.has_frame_numbers = false;
+        stream.by_frame_number.clear();
+    }
+
+    std::vector<stream_identifier> ros_frame_index::get_streams() const
+    {
+        std::vector<stream_identifier> streams;
+        for (auto&& kvp : m_streams)
+            streams.push_back(kvp.first);
+        return streams;
+    }
+
+    bool ros_frame_index::contains(const stream_identifier& stream_id) const
+    {
+        return find(stream_id) != nullptr;
+    }
+
+    const ros_frame_index::stream_index* ros_frame_index::find(const stream_identifier& stream_id) const
+    {
+        auto it = m_streams.find(stream_id);
+        return it == m_streams.end() ? nullptr : &it->second;
+    }
+
+    const std::string& ros_frame_index::get_topic(const stream_identifier& stream_id) const
+    {
+        auto stream = find(stream_id);
+        if (!stream)
+            throw invalid_value_exception(to_string() << "Stream " << stream_id << " is not in the file");
+        return stream->topic;
+    }
+
+    const std::vector<ros_frame_index::entry>& ros_frame_index::get_frames(const stream_identifier& stream_id) const
+    {
+        static const std::vector<entry> no_frames;
+        auto stream = find(stream_id);
+        return stream ? stream->frames : no_frames;
+    }
+
+    bool ros_frame_index::find_at_or_before(const stream_identifier& stream_id, nanoseconds time, entry& result) const
+    {
+        auto stream = find(stream_id);
+        if (!stream)
+            return false;
+
+        auto it = std::upper_bound(stream->frames.begin(), stream->frames.end(), time,
+            [](nanoseconds t, const entry& e) { return t < e.time; });
+        if (it == stream->frames.begin())
+            return false;
+        result = *(--it);
+        return true;
+    }
+
+    size_t ros_frame_index::find_at_or_after(const stream_identifier& stream_id, nanoseconds time) const
+    {
+        auto stream = find(stream_id);
+        if (!stream)
+            return 0;
+
+        auto it = std::lower_bound(stream->frames.begin(), stream->frames.end(), time,
+            [](const entry& e, nanoseconds t) { return e.time < t; });
+        return static_cast<size_t>(it - stream->frames.begin());
+    }
+
+    bool ros_frame_index::has_frame_numbers(const stream_identifier& stream_id) const
+    {
+        auto stream = find(stream_id);
+        return stream && stream->has_frame_numbers;
+    }
+
+    void ros_frame_index::set_frame_numbers(const stream_identifier& stream_id, const std::vector<uint64_t>& frame_numbers)
+    {
+        auto it = m_streams.find(stream_id);
+        if (it == m_streams.end() || it->second.frames.size() != frame_numbers.size())
+            throw invalid_value_exception(to_string() << "Frame numbers do not match the frames of stream " << stream_id);
+
+        for (size_t i = 0; i < frame_numbers.size(); i++)
+            it->second.frames[i].frame_number = frame_numbers[i];
+        sort_frame_numbers(it->second);
+    }
+
+    void ros_frame_index::sort_frame_numbers(stream_index& stream)
+    {
+        // Frame numbers restart when a stream is restarted, so they are not in the order of time
+        stream.by_frame_number.resize(stream.frames.size());
+        for (size_t i = 0; i < stream.frames.size(); i++)
+            stream.by_frame_number[i] = i;
+        std::stable_sort(stream.by_frame_number.begin(), stream.by_frame_number.end(),
+            [&stream](size_t a, size_t b) { return stream.frames[a].frame_number < stream.frames[b].frame_number; });
+        stream.has_frame_numbers = true;
+    }
+
+    bool ros_frame_index::find_frame_number(const stream_identifier& stream_id, uint64_t frame_number, size_t& position) const
+    {
+        auto stream = find(stream_id);
+        if (!stream || !stream->has_frame_numbers)
+            return false;
+
+        auto it = std::lower_bound(stream->by_frame_number.begin(), stream->by_frame_number.end(), frame_number,
+            [stream](size_t i, uint64_t n) { return stream->frames[i].frame_number < n; });
+        if (it == stream->by_frame_number.end() || stream->frames[*it].frame_number != frame_number)
+            return false;
+        position = *it;
+        return true;
+    }
+
+    bool ros_frame_index::sidecar_enabled()
+    {
+        auto value = getenv("LRS_BAG_INDEX_SIDECAR");
+        return value && *value && std::string(value) != "0";
+    }
+
+    std::string ros_frame_index::sidecar_path(const std::string& file)
+    {
+        return file + ".rsidx";
+    }
+
+    // File layout: magic, version, size of the recording, stream count, then per stream:
+    // device, sensor, stream type and stream index, frame count, and the time and frame number of each frame
+    bool ros_frame_index::load_sidecar(const std::string& path, uint64_t file_size)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+            return false;
+
+        auto read = [&file](void* value, size_t size) { file.read(reinterpret_cast<char*>(value), size); };
+        uint32_t magic = 0, version = 0, count = 0;
+        uint64_t size = 0;
+        read(&magic, sizeof(magic));
+        read(&version, sizeof(version));
+        read(&size, sizeof(size));
+        read(&count, sizeof(count));
+        if (!file || magic != FRAME_INDEX_SIDECAR_MAGIC || version != FRAME_INDEX_SIDECAR_VERSION || size != file_size)
+        {
+            LOG_WARNING("Ignoring frame index " << path << " of another recording");
+            return false;
+        }
+
+        std::map<stream_identifier, std::vector<uint64_t>> frame_numbers;
+        for (uint32_t i = 0; i < count; i++)
+        {
+            uint32_t ids[4] = {};
+            uint64_t frames = 0;
+            read(ids, sizeof(ids));
+            read(&frames, sizeof(frames));
+            stream_identifier stream_id{ ids[0], ids[1], static_cast<rs2_stream>(ids[2]), ids[3] };
+            auto stream = find(stream_id);
+            if (!file || !stream || stream->frames.size() != frames)
+                break;
+
+            auto& numbers = frame_numbers[stream_id];
+            numbers.resize(frames);
+            for (uint64_t j = 0; j < frames && file; j++)
+            {
+                int64_t time = 0;
+                read(&time, sizeof(time));
+                read(&numbers[j], sizeof(numbers[j]));
+                if (stream->frames[j].time.count() != time)
+                    file.setstate(std::ios::failbit);
+            }
+            if (!file)
+                break;
+        }
+
+        if (frame_numbers.size() != count || !file)
+        {
+            LOG_WARNING("Ignoring frame index " << path << " that does not match the recording");
+            return false;
+        }
+        for (auto&& kvp : frame_numbers)
+            set_frame_numbers(kvp.first, kvp.second);
+        return true;
+    }
+
+    // Only the streams with frame numbers are saved. The file is replaced at once so that readers never see a partial index
+    void ros_frame_index::save_sidecar(const std::string& path, uint64_t file_size) const
+    {
+        auto temp_path = temp_file_path(path);
+        {
+            std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+            auto write = [&file](const void* value, size_t size) { file.write(reinterpret_cast<const char*>(value), size); };
+
+            uint32_t count = 0;
+            for (auto&& kvp : m_streams)
+                count += kvp.second.has_frame_numbers ? 1 : 0;
+
+            write(&FRAME_INDEX_SIDECAR_MAGIC, sizeof(FRAME_INDEX_SIDECAR_MAGIC));
+            write(&FRAME_INDEX_SIDECAR_VERSION, sizeof(FRAME_INDEX_SIDECAR_VERSION));
+            write(&file_size, sizeof(file_size));
+            write(&count, sizeof(count));
+            for (auto&& kvp : m_streams)
+            {
+                if (!kvp.second.has_frame_numbers)
+                    continue;
+                uint32_t ids[4] = { kvp.first.device_index, kvp.first.sensor_index, static_cast<uint32_t>(kvp.first.stream_type), kvp.first.stream_index };
+                uint64_t frames = kvp.second.frames.size();
+                write(ids, sizeof(ids));
+                write(&frames, sizeof(frames));
+                for (auto&& e : kvp.second.frames)
+                {
+                    int64_t time = e.time.count();
+                    write(&time, sizeof(time));
+                    write(&e.frame_number, sizeof(e.frame_number));
+                }
+            }
+
+            if (!file)
+            {
+                LOG_WARNING("Could not write frame index " << temp_path);
+                file.close();
+                std::remove(temp_path.c_str());
+                return;
+            }
+        }
+
+        if (!replace_file(temp_path, path))
+        {
+            LOG_WARNING("Could not replace frame index " << path);
+            std::remove(temp_path.c_str());
+        }
+    }
+}
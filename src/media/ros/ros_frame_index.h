@@ -0,0 +1,66 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2017 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+#include <core/serialization.h>
+
+namespace librealsense
+{
+    // Time and frame number of every frame of a recording, per stream, ordered by time.
+    // Built from the message index of the bag when it is opened, it finds the frame of a stream at a given time, or
+    // with a given frame number, without going over the messages. Frame numbers are stored in the messages
+    // themselves, so they are filled separately, and can be kept in a sidecar file next to the recording.
+    class ros_frame_index
+    {
+    public:
+        struct entry
+        {
+            device_serializer::nanoseconds time;
+            uint64_t frame_number;
+        };
+
+        // Frames must be added in time order within each stream
+        void add(const device_serializer::stream_identifier& stream_id, const std::string& topic, device_serializer::nanoseconds time);
+
+        std::vector<device_serializer::stream_identifier> get_streams() const;
+        bool contains(const device_serializer::stream_identifier& stream_id) const;
+        const std::string& get_topic(const device_serializer::stream_identifier& stream_id) const;
+        const std::vector<entry>& get_frames(const device_serializer::stream_identifier& stream_id) const;
+
+        // Latest frame of the stream at or before time
+        bool find_at_or_before(const device_serializer::stream_identifier& stream_id, device_serializer::nanoseconds time, entry& result) const;
+        // Position of the earliest frame of the stream at or after time, the number of frames when there is none
+        size_t find_at_or_after(const device_serializer::stream_identifier& stream_id, device_serializer::nanoseconds time) const;
+
+        bool has_frame_numbers(const device_serializer::stream_identifier& stream_id) const;
+        // One frame number per frame of the stream, in time order
+        void set_frame_numbers(const device_serializer::stream_identifier& stream_id, const std::vector<uint64_t>& frame_numbers);
+        // Position of the earliest frame of the stream with this frame number, requires the frame numbers of the stream
+        bool find_frame_number(const device_serializer::stream_identifier& stream_id, uint64_t frame_number, size_t& position) const;
+
+        // The sidecar of a recording is used when LRS_BAG_INDEX_SIDECAR is set
+        static bool sidecar_enabled();
+        static std::string sidecar_path(const std::string& file);
+        // Takes the frame numbers of a sidecar written for the same recording (same size and same frames), returns false otherwise
+        bool load_sidecar(const std::string& path, uint64_t file_size);
+        void save_sidecar(const std::string& path, uint64_t file_size) const;
+
+    private:
+        struct stream_index
+        {
+            std::string topic;
+            std::vector<entry> frames;
+            bool has_frame_numbers = false;
+            std::vector<size_t> by_frame_number; // Positions in frames, sorted by frame number
+        };
+
+        const stream_index* find(const device_serializer::stream_identifier& stream_id) const;
+        static void sort_frame_numbers(stream_index& stream);
+
+        std::map<device_serializer::stream_identifier, stream_index> m_streams;
+    };
+}
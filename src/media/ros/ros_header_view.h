@@ -0,0 +1,58 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2017 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "std_msgs/Header.h"
+
+namespace librealsense
+{
+    // The std_msgs/Header that opens a stamped message (sensor_msgs/Image, sensor_msgs/Imu, ...).
+    // Reading a message as a header view deserializes the header only and leaves the rest of the message untouched.
+    struct ros_header_view
+    {
+        std_msgs::Header header;
+    };
+}
+
+namespace ros
+{
+    namespace message_traits
+    {
+        template<> struct IsFixedSize<librealsense::ros_header_view> : FalseType {};
+        template<> struct IsMessage<librealsense::ros_header_view> : TrueType {};
+        template<> struct HasHeader<librealsense::ros_header_view> : TrueType {};
+
+        // Matches any message type, callers check the type of the message before reading its header
+        template<> struct MD5Sum<librealsense::ros_header_view>
+        {
+            static const char* value() { return "*"; }
+            static const char* value(const librealsense::ros_header_view&) { return value(); }
+        };
+
+        template<> struct DataType<librealsense::ros_header_view>
+        {
+            static const char* value() { return "*"; }
+            static const char* value(const librealsense::ros_header_view&) { return value(); }
+        };
+
+        template<> struct Definition<librealsense::ros_header_view>
+        {
+            static const char* value() { return ""; }
+            static const char* value(const librealsense::ros_header_view&) { return value(); }
+        };
+    }
+
+    namespace serialization
+    {
+        // Read only, the view is never written
+        template<> struct Serializer<librealsense::ros_header_view>
+        {
+            template<typename Stream>
+            inline static void read(Stream& stream, librealsense::ros_header_view& m)
+            {
+                stream.next(m.header);
+            }
+        };
+    }
+}
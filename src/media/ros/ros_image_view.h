@@ -0,0 +1,83 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2017 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <cstring>
+#include "sensor_msgs/Image.h"
+
+namespace librealsense
+{
+    // A sensor_msgs/Image that refers to the pixels of a frame instead of holding a copy of them.
+    // It is written to the bag as a sensor_msgs/Image, with the pixels serialized straight from the frame buffer.
+    struct ros_image_view
+    {
+        sensor_msgs::Image image; // All the fields but data, which is left empty
+        const uint8_t* data;
+        uint32_t size;
+    };
+}
+
+namespace ros
+{
+    namespace message_traits
+    {
+        template<> struct IsFixedSize<librealsense::ros_image_view> : FalseType {};
+        template<> struct IsMessage<librealsense::ros_image_view> : TrueType {};
+        // The header is in image, not in a header member of the view as the trait would require
+        template<> struct HasHeader<librealsense::ros_image_view> : FalseType {};
+
+        template<> struct MD5Sum<librealsense::ros_image_view>
+        {
+            static const char* value() { return MD5Sum<sensor_msgs::Image>::value(); }
+            static const char* value(const librealsense::ros_image_view&) { return value(); }
+        };
+
+        template<> struct DataType<librealsense::ros_image_view>
+        {
+            static const char* value() { return DataType<sensor_msgs::Image>::value(); }
+            static const char* value(const librealsense::ros_image_view&) { return value(); }
+        };
+
+        template<> struct Definition<librealsense::ros_image_view>
+        {
+            static const char* value() { return Definition<sensor_msgs::Image>::value(); }
+            static const char* value(const librealsense::ros_image_view&) { return value(); }
+        };
+    }
+
+    namespace serialization
+    {
+        // Same layout as the serializer of sensor_msgs::Image, the view is never read back
+        template<> struct Serializer<librealsense::ros_image_view>
+        {
+            template<typename Stream>
+            inline static void write(Stream& stream, const librealsense::ros_image_view& m)
+            {
+                write_fields(stream, m.image);
+                stream.next(m.size);
+                if (m.size > 0)
+                    memcpy(stream.advance(m.size), m.data, m.size);
+            }
+
+            inline static uint32_t serializedLength(const librealsense::ros_image_view& m)
+            {
+                LStream stream;
+                write_fields(stream, m.image);
+                return stream.getLength() + sizeof(m.size) + m.size;
+            }
+
+        private:
+            template<typename Stream>
+            inline static void write_fields(Stream& stream, const sensor_msgs::Image& image)
+            {
+                stream.next(image.header);
+                stream.next(image.height);
+                stream.next(image.width);
+                stream.next(image.encoding);
+                stream.next(image.is_bigendian);
+                stream.next(image.step);
+            }
+        };
+    }
+}
@@ -2,13 +2,18 @@
 // Copyright(c) 2017 Intel Corporation. All Rights Reserved.
 
 #pragma once
+#include <cstdlib>
 #include <chrono>
 #include <mutex>
 #include <regex>
 #include <ios>      //For std::hexfloat
+#include <fstream>
 #include <core/serialization.h>
 #include "rosbag/view.h"
 #include "ros_file_format.h"
+#include "ros_frame_index.h"
+#include "ros_header_view.h"
+#include "rvl_codec.h"
 
 namespace librealsense
 {
@@ -17,17 +22,24 @@ namespace librealsense
     class ros_reader: public device_serializer::reader
     {
     public:
-        ros_reader(const std::string& file, const std::shared_ptr<context>& ctx) :
+        // A reader of a file that is already open elsewhere can take the frame index of that reader, instead of building its own
+        ros_reader(const std::string& file, const std::shared_ptr<context>& ctx, std::shared_ptr<ros_frame_index> frame_index = nullptr) :
             m_total_duration(0),
             m_file_path(file),
             m_context(ctx),
             m_version(0),
-            m_metadata_parser_map(md_constant_parser::create_metadata_parser_map())
+            m_metadata_parser_map(md_constant_parser::create_metadata_parser_map()),
+            m_frame_index(frame_index)
         {
             try
             {
                 reset(); //Note: calling a virtual function inside c'tor, safe while base function is pure virtual
                 m_total_duration = get_file_duration(m_file, m_version);
+                if (m_frame_index == nullptr)
+                {
+                    m_frame_index = std::make_shared<ros_frame_index>();
+                    build_frame_index();
+                }
             }
             catch (const std::exception& e)
             {
@@ -97,7 +109,11 @@ namespace librealsense
             auto seek_time_as_rostime = ros::Time(seek_time_as_secs.count());
 
             m_samples_view.reset(new rosbag::View(m_file, FalseQuery()));
-            
+            {
+                std::lock_guard<std::mutex> lock(m_metadata_cursors_mutex);
+                m_metadata_cursors.clear();
+            }
+
             //Using cached topics here and not querying them (before reseting) since a previous call to seek
             // could have changed the view and some streams that should be streaming were dropped.
             //E.g:  Recording Depth+Color, stopping Depth, starting IR, stopping IR and Color. Play IR+Depth: will play only depth, then only IR, then we seek to a point only IR was streaming, and then to 0.
@@ -110,34 +126,107 @@ namespace librealsense
 
         std::vector<std::shared_ptr<serialized_data>> fetch_last_frames(const nanoseconds& seek_time) override
         {
-            std::vector<std::shared_ptr<serialized_data>> result;
-            rosbag::View view(m_file, FalseQuery());
-            auto as_rostime = to_rostime(seek_time);
-            auto start_time = to_rostime(get_static_file_info_timestamp());
-            
-            for (auto topic : m_enabled_streams_topics)
+            if (m_version == legacy_file_format::file_version())
             {
-                view.addQuery(m_file, rosbag::TopicQuery(topic), start_time, as_rostime);
+                return fetch_last_frames_by_view(seek_time);
             }
-            std::map<device_serializer::stream_identifier, ros::Time> last_frames;
-            for (auto&& m : view)
+
+            //The last frame of each stream is found in the frame index, and read through a view of that frame alone
+            std::vector<std::shared_ptr<serialized_data>> result;
+            for (auto&& stream_id : m_frame_index->get_streams())
             {
-                if (m.isType<sensor_msgs::Image>() || m.isType<sensor_msgs::Imu>())
+                auto&& topic = m_frame_index->get_topic(stream_id);
+                ros_frame_index::entry last_frame;
+                if (std::find(m_enabled_streams_topics.begin(), m_enabled_streams_topics.end(), topic) == m_enabled_streams_topics.end()
+                    || !m_frame_index->find_at_or_before(stream_id, seek_time, last_frame))
                 {
-                    auto id = ros_topic::get_stream_identifier(m.getTopic());
-                    last_frames[id] = m.getTime();
+                    continue;
+                }
+                auto as_rostime = ros::Time().fromNSec(last_frame.time.count()); //Exact time of the index entry
+                rosbag::View view(m_file, rosbag::TopicQuery(topic), as_rostime, as_rostime);
+                if (view.begin() != view.end() && (view.begin()->isType<sensor_msgs::Image>() || view.begin()->isType<sensor_msgs::Imu>()))
+                {
+                    result.push_back(create_frame(*view.begin()));
                 }
             }
-            for (auto&& kvp : last_frames)
+            return result;
+        }
+
+        // Random access to the frames of a stream, by their position in the file. These do not move the reader
+        size_t query_frame_count(const device_serializer::stream_identifier& stream_id) const
+        {
+            return m_frame_index->get_frames(stream_id).size();
+        }
+
+        nanoseconds query_frame_time(const device_serializer::stream_identifier& stream_id, size_t position) const
+        {
+            auto&& frames = m_frame_index->get_frames(stream_id);
+            if (position >= frames.size())
             {
-                auto topic = ros_topic::frame_data_topic(kvp.first);
-                rosbag::View view(m_file, rosbag::TopicQuery(topic), kvp.second, kvp.second);
-                auto msg = view.begin();
-                auto new_frame = create_frame(*msg);
-                result.push_back(new_frame);
+                throw invalid_value_exception(to_string() << "Frame " << position << " of stream " << stream_id << " is out of range (" << frames.size() << " frames)");
             }
-            return result;
+            return frames[position].time;
         }
+
+        // Frames read at random may all be held by the application at once, a size of 0 lifts the bound of the frame pool
+        void set_frame_pool_size(uint32_t size)
+        {
+            m_frame_source->get_published_size_option()->set(static_cast<float>(size));
+        }
+
+        std::shared_ptr<serialized_frame> read_frame(const device_serializer::stream_identifier& stream_id, size_t position)
+        {
+            auto&& frames = m_frame_index->get_frames(stream_id);
+            if (position >= frames.size())
+            {
+                throw invalid_value_exception(to_string() << "Frame " << position << " of stream " << stream_id << " is out of range (" << frames.size() << " frames)");
+            }
+
+            //Frames recorded at the same time are told apart by their order
+            auto time = frames[position].time;
+            auto same_time = position - m_frame_index->find_at_or_after(stream_id, time);
+            auto as_rostime = ros::Time().fromNSec(time.count()); //Exact time of the index entry
+            rosbag::View view(m_file, rosbag::TopicQuery(m_frame_index->get_topic(stream_id)), as_rostime, as_rostime);
+            auto msg = view.begin();
+            for (size_t i = 0; i < same_time && msg != view.end(); i++)
+            {
+                ++msg;
+            }
+            if (msg == view.end())
+            {
+                throw io_exception(to_string() << "Frame " << position << " of stream " << stream_id << " is missing from " << m_file_path);
+            }
+            return create_frame(*msg);
+        }
+
+        size_t find_frame(const device_serializer::stream_identifier& stream_id, const nanoseconds& time) const
+        {
+            return m_frame_index->find_at_or_after(stream_id, time);
+        }
+
+        // Position of the frame of a stream with the given frame number. Frame numbers are read from the file on the first
+        // lookup in a stream, unless the sidecar of the file already holds them
+        bool find_frame_number(const device_serializer::stream_identifier& stream_id, uint64_t frame_number, size_t& position)
+        {
+            if (!m_frame_index->contains(stream_id))
+                return false;
+            if (!m_frame_index->has_frame_numbers(stream_id))
+            {
+                load_frame_numbers(stream_id);
+            }
+            return m_frame_index->find_frame_number(stream_id, frame_number, position);
+        }
+
+        const ros_frame_index& get_frame_index() const
+        {
+            return *m_frame_index;
+        }
+
+        std::shared_ptr<ros_frame_index> get_shared_frame_index() const
+        {
+            return m_frame_index;
+        }
+
         nanoseconds query_duration() const override
         {
             return m_total_duration;
@@ -145,8 +234,12 @@ namespace librealsense
 
         void reset() override
         {
+            {
+                std::lock_guard<std::mutex> lock(m_metadata_cursors_mutex);
+                m_metadata_cursors.clear();
+            }
             m_file.close();
-            m_file.open(m_file_path, rosbag::BagMode::Read);
+            m_file.open(m_file_path, mapped_read_enabled() ? rosbag::BagMode::Read | rosbag::BagMode::Mapped : rosbag::BagMode::Read);
             m_version = read_file_version(m_file);
             m_samples_view = nullptr;
             m_frame_source = std::make_shared<frame_source>(m_version == 1 ? 128 : 32);
@@ -240,6 +333,97 @@ namespace librealsense
 
     private:
 
+        // Chunks are read from a mapping of the file when LRS_BAG_MAPPED_READ is set, sparing a copy of every chunk.
+        // Opt-in, since a file truncated while mapped, or a failing read from a network file system, raises SIGBUS
+        // instead of an io_exception
+        static bool mapped_read_enabled()
+        {
+            auto value = getenv("LRS_BAG_MAPPED_READ");
+            return value && *value && std::string(value) != "0";
+        }
+
+        void build_frame_index()
+        {
+            if (m_version == legacy_file_format::file_version())
+            {
+                return;
+            }
+
+            //Going over the index of the bag, the messages themselves are not read
+            rosbag::View frames_view(m_file, FrameQuery());
+            for (auto it = frames_view.begin(); it != frames_view.end(); ++it)
+            {
+                m_frame_index->add(ros_topic::get_stream_identifier(it->getTopic()), it->getTopic(), to_nanoseconds(it->getTime()));
+            }
+
+            if (ros_frame_index::sidecar_enabled())
+            {
+                m_frame_index->load_sidecar(ros_frame_index::sidecar_path(m_file_path), get_file_size());
+            }
+        }
+
+        void load_frame_numbers(const device_serializer::stream_identifier& stream_id)
+        {
+            LOG_INFO("Reading the frame numbers of stream " << stream_id << " from " << m_file_path);
+            std::vector<uint64_t> frame_numbers;
+            rosbag::View view(m_file, rosbag::TopicQuery(m_frame_index->get_topic(stream_id)));
+            for (auto&& msg : view)
+            {
+                //Only the header of the message is deserialized, the frame itself is left in the file
+                if (msg.isType<sensor_msgs::Image>() || msg.isType<sensor_msgs::Imu>())
+                {
+                    frame_numbers.push_back(msg.instantiate<ros_header_view>()->header.seq);
+                }
+                else
+                {
+                    frame_numbers.push_back(0); //No support for frame numbers
+                }
+            }
+            m_frame_index->set_frame_numbers(stream_id, frame_numbers);
+
+            if (ros_frame_index::sidecar_enabled())
+            {
+                m_frame_index->save_sidecar(ros_frame_index::sidecar_path(m_file_path), get_file_size());
+            }
+        }
+
+        uint64_t get_file_size() const
+        {
+            std::ifstream file(m_file_path, std::ios::binary | std::ios::ate);
+            return file ? static_cast<uint64_t>(file.tellg()) : 0;
+        }
+
+        std::vector<std::shared_ptr<serialized_data>> fetch_last_frames_by_view(const nanoseconds& seek_time)
+        {
+            std::vector<std::shared_ptr<serialized_data>> result;
+            rosbag::View view(m_file, FalseQuery());
+            auto as_rostime = to_rostime(seek_time);
+            auto start_time = to_rostime(get_static_file_info_timestamp());
+            
+            for (auto topic : m_enabled_streams_topics)
+            {
+                view.addQuery(m_file, rosbag::TopicQuery(topic), start_time, as_rostime);
+            }
+            std::map<device_serializer::stream_identifier, ros::Time> last_frames;
+            for (auto&& m : view)
+            {
+                if (m.isType<sensor_msgs::Image>() || m.isType<sensor_msgs::Imu>())
+                {
+                    auto id = ros_topic::get_stream_identifier(m.getTopic());
+                    last_frames[id] = m.getTime();
+                }
+            }
+            for (auto&& kvp : last_frames)
+            {
+                auto topic = ros_topic::frame_data_topic(kvp.first);
+                rosbag::View view(m_file, rosbag::TopicQuery(topic), kvp.second, kvp.second);
+                auto msg = view.begin();
+                auto new_frame = create_frame(*msg);
+                result.push_back(new_frame);
+            }
+            return result;
+        }
+
         template <typename ROS_TYPE>      
         static typename ROS_TYPE::ConstPtr instantiate_msg(const rosbag::MessageInstance& msg)
         {
@@ -373,17 +557,41 @@ namespace librealsense
             return true;
         }
 
-        static std::map<std::string, std::string> get_frame_metadata(const rosbag::Bag& bag, 
+        // Metadata messages of a frame, read through a view of the metadata topic that moves forward along with the frames,
+        // instead of through a new view of every frame time
+        std::vector<rosbag::MessageInstance> read_frame_metadata(const rosbag::Bag& bag, const std::string& topic, const ros::Time& time) const
+        {
+            std::lock_guard<std::mutex> lock(m_metadata_cursors_mutex);
+            auto& cursor = m_metadata_cursors[topic];
+            if (cursor.view == nullptr || time <= cursor.time)
+            {
+                cursor.view.reset(new rosbag::View(bag, rosbag::TopicQuery(topic), time));
+                cursor.it = cursor.view->begin();
+            }
+            cursor.time = time;
+
+            while (cursor.it != cursor.view->end() && cursor.it->getTime() < time)
+            {
+                ++cursor.it;
+            }
+            std::vector<rosbag::MessageInstance> messages;
+            for (; cursor.it != cursor.view->end() && cursor.it->getTime() == time; ++cursor.it)
+            {
+                messages.push_back(*cursor.it);
+            }
+            return messages;
+        }
+
+        std::map<std::string, std::string> get_frame_metadata(const rosbag::Bag& bag,
             const std::string& topic,
             const device_serializer::stream_identifier& stream_id, 
             const rosbag::MessageInstance &msg, 
-            frame_additional_data& additional_data)
+            frame_additional_data& additional_data) const
         {
             uint32_t total_md_size = 0;
             std::map<std::string, std::string> remaining;
-            rosbag::View frame_metadata_view(bag, rosbag::TopicQuery(topic), msg.getTime(), msg.getTime());
 
-            for (auto message_instance : frame_metadata_view)
+            for (auto message_instance : read_frame_metadata(bag, topic, msg.getTime()))
             {
                 auto key_val_msg = instantiate_msg<diagnostic_msgs::KeyValue>(message_instance);
                 if (key_val_msg->key == TIMESTAMP_DOMAIN_MD_STR)
@@ -433,7 +641,8 @@ namespace librealsense
         frame_holder create_image_from_message(const rosbag::MessageInstance &image_data) const
         {
             LOG_DEBUG("Trying to create an image frame from message");
-            auto msg = instantiate_msg<sensor_msgs::Image>(image_data);
+            // The message is instantiated for this frame alone, so its data can be decoded in place
+            auto msg = std::const_pointer_cast<sensor_msgs::Image>(instantiate_msg<sensor_msgs::Image>(image_data));
             frame_additional_data additional_data{};
             std::chrono::duration<double, std::milli> timestamp_ms(std::chrono::duration<double>(msg->header.stamp.toSec()));
             additional_data.timestamp = timestamp_ms.count();
@@ -455,6 +664,8 @@ namespace librealsense
                 get_frame_metadata(m_file, info_topic, stream_id, image_data, additional_data);
             }
 
+            decode_image_data(*msg);
+
             frame_interface* frame = m_frame_source->alloc_frame((stream_id.stream_type == RS2_STREAM_DEPTH) ? RS2_EXTENSION_DEPTH_FRAME : RS2_EXTENSION_VIDEO_FRAME,
                 msg->data.size(), additional_data, true);
             if (frame == nullptr)
@@ -478,6 +689,19 @@ namespace librealsense
             return std::move(fh);
         }
 
+        // Replaces RVL encoded data of an image with the raw pixels, and restores the encoding of the pixels
+        static void decode_image_data(sensor_msgs::Image& msg)
+        {
+            std::string prefix = RVL_IMAGE_ENCODING_PREFIX;
+            if (msg.encoding.compare(0, prefix.size(), prefix) != 0)
+                return;
+
+            std::vector<uint8_t> pixels(msg.step * msg.height);
+            rvl::decode(msg.data.data(), msg.data.size(), reinterpret_cast<uint16_t*>(pixels.data()), pixels.size() / sizeof(uint16_t));
+            msg.data = std::move(pixels);
+            msg.encoding = msg.encoding.substr(prefix.size());
+        }
+
         frame_holder create_motion_sample(const rosbag::MessageInstance &motion_data) const
         {
             LOG_DEBUG("Trying to create a motion frame from message");
@@ -1244,5 +1468,15 @@ namespace librealsense
         std::shared_ptr<metadata_parser_map>    m_metadata_parser_map;
         std::shared_ptr<context>                m_context;
         uint32_t                                m_version;
+        std::shared_ptr<ros_frame_index>        m_frame_index;     // Shared by the readers of the same file
+
+        struct metadata_cursor
+        {
+            std::unique_ptr<rosbag::View> view;
+            rosbag::View::iterator it;
+            ros::Time time;
+        };
+        mutable std::map<std::string, metadata_cursor> m_metadata_cursors;
+        mutable std::mutex                             m_metadata_cursors_mutex;   // Metadata is read from const methods
     };
 }
@@ -7,6 +7,11 @@
 #include <memory>
 #include <iomanip>
 #include <ios>      //For std::hexfloat
+#include <thread>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <tuple>
 #include "core/debug.h"
 #include "core/serialization.h"
 #include "archive.h"
@@ -14,19 +19,47 @@
 #include "stream.h"
 #include "rosbag/bag.h"
 #include "ros_file_format.h"
+#include "rvl_codec.h"
+#include "ros_image_view.h"
 
 namespace librealsense
 {
     using namespace device_serializer;
 
+    // Upper bound on the default number of threads compressing the chunks of a single file
+    const uint32_t ROS_WRITER_MAX_COMPRESSION_THREADS = 4;
+    // Time of the first frame of the files that follow a rotation (a message at time 0 is not valid in a bag)
+    constexpr nanoseconds ROS_WRITER_SEGMENT_START_TIME = std::chrono::microseconds(1);
+
     class ros_writer: public writer
     {
     public:
-        explicit ros_writer(const std::string& file) : m_file_path(file)
+        // compression_threads of 0 compresses on as many threads as the hardware runs, up to ROS_WRITER_MAX_COMPRESSION_THREADS
+        explicit ros_writer(const std::string& file, rs2_record_compression compression = RS2_RECORD_COMPRESSION_LZ4, uint32_t chunk_size = 0, uint32_t compression_threads = 0)
+            : m_compression(compression), m_chunk_size(chunk_size), m_compression_threads(compression_threads), m_rvl_depth(compression == RS2_RECORD_COMPRESSION_LZ4_RVL_DEPTH),
+              m_max_file_bytes(0), m_max_file_duration(0), m_segment_started(false), m_segment_start(0), m_segment_offset(0)
         {
-            m_bag.open(file, rosbag::BagMode::Write);
-            m_bag.setCompression(rosbag::CompressionType::LZ4);
-            write_file_version();
+            open_file(file);
+        }
+
+        ~ros_writer()
+        {
+            //The closing thread closes every file left in its queue before it exits
+            {
+                std::lock_guard<std::mutex> lock(m_closing_mutex);
+                m_closing_stopped = true;
+            }
+            m_closing_cv.notify_one();
+            if (m_closing_thread.joinable())
+                m_closing_thread.join();
+        }
+
+        // Starts a new file when the current one reaches max_bytes (at the end of a chunk) or max_duration of recording, 0 for no limit.
+        // Files after the first are named after it, with the number of the file appended (e.g. record_1.bag, record_2.bag)
+        void set_rotation(uint64_t max_bytes, const nanoseconds& max_duration) override
+        {
+            m_max_file_bytes = max_bytes;
+            m_max_file_duration = max_duration;
         }
 
         void write_device_description(const librealsense::device_snapshot& device_description) override
@@ -47,6 +80,16 @@ namespace librealsense
 
         void write_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_holder&& frame) 
         {
+            if (!m_segment_started)
+            {
+                m_segment_start = timestamp;
+                m_segment_started = true;
+            }
+            else if (rotation_due(timestamp))
+            {
+                rotate(timestamp);
+            }
+
             if (Is<video_frame>(frame.frame))
             {
                 write_video_frame(stream_id, timestamp, std::move(frame));
@@ -78,10 +121,128 @@ namespace librealsense
 
         const std::string& get_file_name() const override
         {
-            return m_file_path;
+            //Names are never removed from m_file_paths, so the reference stays valid after a rotation
+            std::lock_guard<std::mutex> lock(m_file_paths_mutex);
+            return m_file_paths.back();
         }
 
     private:
+        void open_file(const std::string& file)
+        {
+            m_bag = std::make_shared<rosbag::Bag>();
+            m_bag->open(file, rosbag::BagMode::Write);
+            if (m_chunk_size > 0)
+                m_bag->setChunkThreshold(m_chunk_size);
+            if (m_compression == RS2_RECORD_COMPRESSION_LZ4 || m_compression == RS2_RECORD_COMPRESSION_LZ4_RVL_DEPTH)
+            {
+                // Chunks are compressed on worker threads while the recording thread keeps writing
+                auto threads = m_compression_threads;
+                if (threads == 0)
+                    threads = std::min(std::max(std::thread::hardware_concurrency(), 1u), ROS_WRITER_MAX_COMPRESSION_THREADS);
+                m_bag->setCompression(rosbag::CompressionType::LZ4);
+                m_bag->setCompressionThreads(threads);
+            }
+            {
+                std::lock_guard<std::mutex> lock(m_file_paths_mutex);
+                m_file_paths.push_back(file);
+            }
+            write_file_version();
+        }
+
+        bool rotation_due(const nanoseconds& timestamp) const
+        {
+            //The size of the file grows a chunk at a time, so files are split at the end of a chunk
+            if (m_max_file_bytes > 0 && m_bag->getSize() >= m_max_file_bytes)
+                return true;
+            return m_max_file_duration.count() > 0 && timestamp - m_segment_start >= m_max_file_duration;
+        }
+
+        static std::string numbered_file_name(const std::string& file, size_t number)
+        {
+            auto dot = file.find_last_of('.');
+            auto separator = file.find_last_of("/\\");
+            if (dot == std::string::npos || (separator != std::string::npos && dot < separator))
+                return file + "_" + std::to_string(number);
+            return file.substr(0, dot) + "_" + std::to_string(number) + file.substr(dot);
+        }
+
+        // Continues the recording in a new file, which starts with the description of the device and the streams, so that it plays
+        // on its own. Times in the new file start over from the frame that triggered the rotation
+        void rotate(const nanoseconds& timestamp)
+        {
+            std::string first_file;
+            size_t number;
+            {
+                std::lock_guard<std::mutex> lock(m_file_paths_mutex);
+                first_file = m_file_paths.front();
+                number = m_file_paths.size();
+            }
+
+            //Closing writes the last chunks and the index of the file, which is left to another thread so that recording goes on meanwhile.
+            //The recording thread only queues the file, it never waits for an earlier close to complete
+            {
+                std::lock_guard<std::mutex> lock(m_closing_mutex);
+                m_closing_bags.push_back(m_bag);
+                if (!m_closing_thread.joinable())
+                    m_closing_thread = std::thread([this]() { close_files(); });
+            }
+            m_closing_cv.notify_one();
+
+            open_file(numbered_file_name(first_file, number));
+            m_segment_start = timestamp;
+            m_segment_offset = timestamp - ROS_WRITER_SEGMENT_START_TIME;
+            m_extrinsics_msgs.clear();
+            m_written_options_descriptions.clear();
+
+            for (auto&& kvp : m_snapshots)
+            {
+                try
+                {
+                    write_extension_snapshot(std::get<1>(kvp.first), std::get<2>(kvp.first), get_static_file_info_timestamp(), std::get<3>(kvp.first), kvp.second, std::get<0>(kvp.first));
+                }
+                catch (const std::exception& e)
+                {
+                    LOG_WARNING("Failed to write " << std::get<3>(kvp.first) << " snapshot to " << get_file_name() << ". Exception: " << e.what());
+                }
+            }
+            LOG_INFO("Recording continues in " << get_file_name());
+        }
+
+        // Body of the closing thread, closes the files left by rotations in the order they were left
+        void close_files()
+        {
+            while (true)
+            {
+                std::shared_ptr<rosbag::Bag> bag;
+                {
+                    std::unique_lock<std::mutex> lock(m_closing_mutex);
+                    m_closing_cv.wait(lock, [this]() { return m_closing_stopped || !m_closing_bags.empty(); });
+                    if (m_closing_bags.empty())
+                        return;
+                    bag = m_closing_bags.front();
+                    m_closing_bags.pop_front();
+                }
+
+                try
+                {
+                    bag->close();
+                }
+                catch (const std::exception& e)
+                {
+                    LOG_ERROR("Failed to close recorded file " << bag->getFileName() << ". Exception: " << e.what());
+                }
+            }
+        }
+
+        // Times of the messages in the current file
+        nanoseconds to_file_time(const nanoseconds& time) const
+        {
+            if (m_segment_offset.count() == 0 || time == get_static_file_info_timestamp())
+                return time;
+            //Messages that were captured before the rotation (e.g. samples of a batched motion frame) are written at its beginning
+            return std::max(time - m_segment_offset, ROS_WRITER_SEGMENT_START_TIME);
+        }
+
         void write_file_version()
         {
             std_msgs::UInt32 msg;
@@ -174,7 +335,9 @@ namespace librealsense
 
         void write_video_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_holder&& frame)
         {
-            sensor_msgs::Image image;
+            // The pixels are serialized straight from the frame into the bag, which holds on to the frame until then
+            ros_image_view view;
+            auto& image = view.image;
             auto vid_frame = dynamic_cast<librealsense::video_frame*>(frame.frame);
             assert(vid_frame != nullptr);
 
@@ -185,51 +348,73 @@ namespace librealsense
             image.is_bigendian = is_big_endian();
             auto size = vid_frame->get_stride() * vid_frame->get_height();
             auto p_data = vid_frame->get_frame_data();
-            image.data.assign(p_data, p_data + size);
+            auto format = vid_frame->get_stream()->get_format();
+            // Frames whose encoding would not be smaller than their pixels are written raw, the encoding tells them apart
+            if (m_rvl_depth && (format == RS2_FORMAT_Z16 || format == RS2_FORMAT_DISPARITY16) && size % sizeof(uint16_t) == 0 &&
+                rvl::encode(reinterpret_cast<const uint16_t*>(p_data), size / sizeof(uint16_t), m_rvl_buffer, size - 1))
+            {
+                image.encoding = RVL_IMAGE_ENCODING_PREFIX + image.encoding;
+                view.data = m_rvl_buffer.data();
+                view.size = static_cast<uint32_t>(m_rvl_buffer.size());
+            }
+            else
+            {
+                view.data = p_data;
+                view.size = static_cast<uint32_t>(size);
+            }
             image.header.seq = static_cast<uint32_t>(vid_frame->get_frame_number());
             std::chrono::duration<double, std::milli> timestamp_ms(vid_frame->get_frame_timestamp());
             image.header.stamp = ros::Time(std::chrono::duration<double>(timestamp_ms).count());
             std::string TODO_CORRECT_ME = "0";
             image.header.frame_id = TODO_CORRECT_ME;
             auto image_topic = ros_topic::frame_data_topic(stream_id);
-            write_message(image_topic, timestamp, image);
+            write_message(image_topic, timestamp, view);
             write_additional_frame_messages(stream_id, timestamp, frame);
         }
 
         void write_motion_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_holder&& frame)
         {
-            sensor_msgs::Imu imu_msg;
             if (!frame)
             {
                 throw io_exception("Null frame passed to write_motion_frame");
             }
-            
-            imu_msg.header.seq = static_cast<uint32_t>(frame.frame->get_frame_number());
-            std::chrono::duration<double, std::milli> timestamp_ms(frame.frame->get_frame_timestamp());
-            imu_msg.header.stamp = ros::Time(std::chrono::duration<double>(timestamp_ms).count());
-            std::string TODO_CORRECT_ME = "0";
-            imu_msg.header.frame_id = TODO_CORRECT_ME;
-            auto data_ptr = reinterpret_cast<const float*>(frame.frame->get_frame_data());
-            if (stream_id.stream_type == RS2_STREAM_ACCEL)
-            {
-                imu_msg.linear_acceleration.x = data_ptr[0];
-                imu_msg.linear_acceleration.y = data_ptr[1];
-                imu_msg.linear_acceleration.z = data_ptr[2];
-            }
-           
-            else if (stream_id.stream_type == RS2_STREAM_GYRO)
-            {
-                imu_msg.angular_velocity.x = data_ptr[0];
-                imu_msg.angular_velocity.y = data_ptr[1];
-                imu_msg.angular_velocity.z = data_ptr[2]; 
-            }
-            else
-            {
-                throw io_exception("Unsupported stream type for a motion frame");
-            }
 
+            // Batched motion frames are written as a message per sample, and played back as single sample frames
+            auto motion = As<motion_frame>(frame.frame);
+            auto samples_count = motion ? motion->get_samples_count() : 1;
             auto topic = ros_topic::frame_data_topic(stream_id);
-            write_message(topic, timestamp, imu_msg);
+            for (uint32_t i = 0; i < samples_count; i++)
+            {
+                sensor_msgs::Imu imu_msg;
+                auto sample_timestamp = motion ? motion->get_sample_timestamp(i) : frame.frame->get_frame_timestamp();
+                imu_msg.header.seq = static_cast<uint32_t>(motion ? motion->get_sample_frame_number(i) : frame.frame->get_frame_number());
+                std::chrono::duration<double, std::milli> timestamp_ms(sample_timestamp);
+                imu_msg.header.stamp = ros::Time(std::chrono::duration<double>(timestamp_ms).count());
+                std::string TODO_CORRECT_ME = "0";
+                imu_msg.header.frame_id = TODO_CORRECT_ME;
+                auto data_ptr = reinterpret_cast<const float*>(motion ? motion->get_sample_data(i) : frame.frame->get_frame_data());
+                if (stream_id.stream_type == RS2_STREAM_ACCEL)
+                {
+                    imu_msg.linear_acceleration.x = data_ptr[0];
+                    imu_msg.linear_acceleration.y = data_ptr[1];
+                    imu_msg.linear_acceleration.z = data_ptr[2];
+                }
+
+                else if (stream_id.stream_type == RS2_STREAM_GYRO)
+                {
+                    imu_msg.angular_velocity.x = data_ptr[0];
+                    imu_msg.angular_velocity.y = data_ptr[1];
+                    imu_msg.angular_velocity.z = data_ptr[2];
+                }
+                else
+                {
+                    throw io_exception("Unsupported stream type for a motion frame");
+                }
+
+                auto sample_offset = std::chrono::duration_cast<nanoseconds>(
+                    std::chrono::duration<double, std::milli>(sample_timestamp - frame.frame->get_frame_timestamp()));
+                write_message(topic, timestamp + sample_offset, imu_msg);
+            }
             write_additional_frame_messages(stream_id, timestamp, frame);
         }
 
@@ -387,6 +572,12 @@ namespace librealsense
         }
         void write_extension_snapshot(uint32_t device_id, uint32_t sensor_id, const nanoseconds& timestamp, rs2_extension type, std::shared_ptr<librealsense::extension_snapshot> snapshot, bool is_device)
         {
+            //The latest snapshot of each kind is kept, to describe the device and its streams at the beginning of the next files
+            auto stream = As<stream_profile_interface>(snapshot);
+            snapshot_key key{ is_device, device_id, sensor_id, type,
+                              stream ? stream->get_stream_type() : RS2_STREAM_ANY, stream ? stream->get_stream_index() : 0 };
+            m_snapshots[key] = snapshot;
+
             switch (type)
             {
             case RS2_EXTENSION_INFO:
@@ -504,7 +695,7 @@ namespace librealsense
         {
             try
             {
-                m_bag.write(topic, to_rostime(time), msg);
+                m_bag->write(topic, to_rostime(to_file_time(time)), msg);
                 LOG_DEBUG("Recorded: \"" << topic << "\" . TS: " << time.count());
             }
             catch (rosbag::BagIOException& e)
@@ -519,9 +710,29 @@ namespace librealsense
             return (*reinterpret_cast<char*>(&num) == 1) ? 0 : 1; //Little Endian: (char)0x0001 => 0x01, Big Endian: (char)0x0001 => 0x00,
         }
 
+        // Device or sensor, device index, sensor index, extension, and for stream profiles the stream type and index
+        typedef std::tuple<bool, uint32_t, uint32_t, rs2_extension, rs2_stream, int> snapshot_key;
+
         std::map<stream_identifier, geometry_msgs::Transform> m_extrinsics_msgs;
-        std::string m_file_path;
-        rosbag::Bag m_bag;
+        std::deque<std::string> m_file_paths;
+        mutable std::mutex m_file_paths_mutex;
+        rs2_record_compression m_compression;
+        uint32_t m_chunk_size;
+        uint32_t m_compression_threads;
+        bool m_rvl_depth;
+        std::vector<uint8_t> m_rvl_buffer;
+        std::shared_ptr<rosbag::Bag> m_bag;
+        std::thread m_closing_thread;
+        std::deque<std::shared_ptr<rosbag::Bag>> m_closing_bags;
+        std::mutex m_closing_mutex;
+        std::condition_variable m_closing_cv;
+        bool m_closing_stopped = false;
         std::map<uint32_t, std::set<rs2_option>> m_written_options_descriptions;
+        std::map<snapshot_key, std::shared_ptr<extension_snapshot>> m_snapshots;
+        uint64_t m_max_file_bytes;
+        nanoseconds m_max_file_duration;
+        bool m_segment_started;
+        nanoseconds m_segment_start;
+        nanoseconds m_segment_offset;   // Capture time of the beginning of the current file, 0 for the first file
     };
 }
@@ -0,0 +1,215 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2017 Intel Corporation. All Rights Reserved.
+
+#include "rvl_codec.h"
+#include "types.h"
+
+#include <algorithm>
+#include <cstring>
+
+#ifdef __SSE2__
+#include <emmintrin.h> // For SSE2 intrinsics used to find the run boundaries
+#endif
+
+namespace librealsense
+{
+    namespace rvl
+    {
+        const size_t HEADER_SIZE = sizeof(uint32_t);
+
+        // Length of the run of zero (or of non zero) pixels starting at p, testing 8 pixels at a time where possible
+        template<bool zeros>
+        static size_t run_length(const uint16_t* p, size_t n)
+        {
+            size_t i = 0;
+#ifdef __SSE2__
+            const __m128i zero = _mm_setzero_si128();
+            for (; i + 8 <= n; i += 8)
+            {
+                auto mask = _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i)), zero));
+                if (mask != (zeros ? 0xFFFF : 0))
+                    break;
+            }
+#endif
+            while (i < n && (p[i] == 0) == zeros)
+                ++i;
+            return i;
+        }
+
+        class nibble_writer
+        {
+        public:
+            explicit nibble_writer(uint8_t* out) : _out(out), _word(0), _nibbles(0) {}
+
+            void put(uint32_t value)
+            {
+                // Most deltas of a smooth surface fit a single nibble
+                while (value > 0x7)
+                {
+                    push(0x8 | (value & 0x7));
+                    value >>= 3;
+                }
+                push(value);
+            }
+
+            // Bytes written so far, not counting the nibbles of the current word
+            size_t size(const uint8_t* begin) const { return _out - begin; }
+
+            // Pads the last word, and returns the end of the output
+            uint8_t* finish()
+            {
+                if (_nibbles)
+                {
+                    _word <<= 4 * (8 - _nibbles);
+                    flush();
+                }
+                return _out;
+            }
+
+        private:
+            void push(uint32_t nibble)
+            {
+                _word = (_word << 4) | nibble;
+                if (++_nibbles == 8)
+                    flush();
+            }
+
+            void flush()
+            {
+                memcpy(_out, &_word, sizeof(_word));
+                _out += sizeof(_word);
+                _word = 0;
+                _nibbles = 0;
+            }
+
+            uint8_t* _out;
+            uint32_t _word;
+            int _nibbles;
+        };
+
+        class nibble_reader
+        {
+        public:
+            nibble_reader(const uint8_t* data, const uint8_t* end) : _data(data), _end(end), _word(0), _nibbles(0) {}
+
+            uint32_t get()
+            {
+                uint32_t value = 0;
+                int shift = 0;
+                uint32_t nibble;
+                do
+                {
+                    if (!_nibbles)
+                    {
+                        if (_end - _data < static_cast<ptrdiff_t>(sizeof(_word)))
+                            throw io_exception("RVL depth encoding is truncated");
+                        memcpy(&_word, _data, sizeof(_word));
+                        _data += sizeof(_word);
+                        _nibbles = 8;
+                    }
+                    nibble = _word >> 28;
+                    _word <<= 4;
+                    --_nibbles;
+
+                    if (shift > 30)
+                        throw io_exception("RVL depth encoding is corrupt");
+                    value |= (nibble & 0x7) << shift;
+                    shift += 3;
+                } while (nibble & 0x8);
+                return value;
+            }
+
+        private:
+            const uint8_t* _data;
+            const uint8_t* _end;
+            uint32_t _word;
+            int _nibbles;
+        };
+
+        bool encode(const uint16_t* pixels, size_t count, std::vector<uint8_t>& out, size_t max_size)
+        {
+            // A valid pixel takes at most 6 nibbles, and the run lengths around a single valid pixel 2 more
+            out.resize(HEADER_SIZE + 4 * count + 32);
+            auto size = static_cast<uint32_t>(count);
+            memcpy(out.data(), &size, HEADER_SIZE);
+
+            nibble_writer writer(out.data() + HEADER_SIZE);
+            int32_t previous = 0;
+            size_t i = 0;
+            while (i < count)
+            {
+                auto zeros = run_length<true>(pixels + i, count - i);
+                i += zeros;
+                auto valid = run_length<false>(pixels + i, count - i);
+
+                writer.put(static_cast<uint32_t>(zeros));
+                writer.put(static_cast<uint32_t>(valid));
+                for (auto end = i + valid; i < end; ++i)
+                {
+                    int32_t delta = static_cast<int32_t>(pixels[i]) - previous;
+                    writer.put((static_cast<uint32_t>(delta) << 1) ^ static_cast<uint32_t>(delta >> 31));
+                    previous = pixels[i];
+                }
+
+                // Checked once per run, so that noisy images that do not compress stop costing encoding time early
+                if (writer.size(out.data()) > max_size)
+                    return false;
+            }
+            out.resize(writer.finish() - out.data());
+            return out.size() <= max_size;
+        }
+
+        size_t decoded_size(const uint8_t* data, size_t size)
+        {
+            if (size < HEADER_SIZE)
+                throw io_exception("RVL depth encoding is truncated");
+            uint32_t count;
+            memcpy(&count, data, HEADER_SIZE);
+            return count;
+        }
+
+        void decode(const uint8_t* data, size_t size, uint16_t* pixels, size_t count)
+        {
+            if (decoded_size(data, size) != count)
+                throw io_exception(to_string() << "RVL depth encoding holds " << decoded_size(data, size) << " pixels, expected " << count);
+
+            // Largest zigzag code of the delta between two 16 bit pixels
+            const uint32_t MAX_ZIGZAG = 2 * 0xFFFF;
+
+            nibble_reader reader(data + HEADER_SIZE, data + size);
+            uint32_t previous = 0;
+            size_t i = 0;
+            while (i < count)
+            {
+                size_t zeros = reader.get();
+                size_t valid = reader.get();
+                if (zeros > count - i || valid > count - i - zeros)
+                    throw io_exception("RVL depth encoding is corrupt");
+
+                std::fill(pixels + i, pixels + i + zeros, static_cast<uint16_t>(0));
+                i += zeros;
+                for (auto end = i + valid; i < end; ++i)
+                {
+                    // Unsigned arithmetic, a delta that leaves the 16 bit range can only come from a corrupt encoding
+                    auto zigzag = reader.get();
+                    if (zigzag > MAX_ZIGZAG)
+                        throw io_exception("RVL depth encoding is corrupt");
+                    if (zigzag & 1)
+                    {
+                        auto decrement = (zigzag >> 1) + 1;
+                        if (decrement > previous)
+                            throw io_exception("RVL depth encoding is corrupt");
+                        previous -= decrement;
+                    }
+                    else
+                    {
+                        previous += zigzag >> 1;
+                        if (previous > 0xFFFF)
+                            throw io_exception("RVL depth encoding is corrupt");
+                    }
+                    pixels[i] = static_cast<uint16_t>(previous);
+                }
+            }
+        }
+    }
+}
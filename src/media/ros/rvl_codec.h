@@ -0,0 +1,28 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2017 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace librealsense
+{
+    // Lossless encoding of 16 bit depth images, in the RVL family (A. D. Wilson, "Fast Lossless Depth Image Compression", 2017).
+    // Runs of zero (invalid) pixels and runs of valid pixels alternate. Each run length, and each valid pixel as the zigzag
+    // delta from the previous valid pixel, is written as a variable length code of 3 bit nibbles, packed in 32 bit words.
+    // The encoding starts with the number of pixels it holds.
+    namespace rvl
+    {
+        // Replaces the content of out with the encoding of count pixels.
+        // Gives up and returns false, leaving out unspecified, as soon as the encoding grows beyond max_size bytes
+        bool encode(const uint16_t* pixels, size_t count, std::vector<uint8_t>& out, size_t max_size = SIZE_MAX);
+
+        // Number of pixels held by an encoding
+        size_t decoded_size(const uint8_t* data, size_t size);
+
+        // Decodes exactly count pixels, throws io_exception on a truncated or corrupt encoding
+        void decode(const uint8_t* data, size_t size, uint16_t* pixels, size_t count);
+    }
+}
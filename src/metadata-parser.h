@@ -248,6 +248,26 @@ namespace librealsense
         return parser;
     }
 
+    /**\brief provide attributes of the kernel frame buffer, available when the backend reports its dequeue time*/
+    template<class St, class Attribute>
+    class md_dequeued_buffer_parser : public md_additional_parser<St, Attribute>
+    {
+    public:
+        md_dequeued_buffer_parser(Attribute St::* attribute_name) :
+            md_additional_parser<St, Attribute>(attribute_name) {};
+
+        bool supports(const librealsense::frame & frm) const override
+        { return frm.additional_data.dequeue_time != 0; }
+    };
+
+    /**\brief A utility function to create dequeued buffer parser*/
+    template<class St, class Attribute>
+    std::shared_ptr<md_attribute_parser_base> make_dequeued_buffer_parser(Attribute St::* attribute)
+    {
+        std::shared_ptr<md_dequeued_buffer_parser<St, Attribute>> parser(new md_dequeued_buffer_parser<St, Attribute>(attribute));
+        return parser;
+    }
+
     /**\brief Optical timestamp for RS4xx devices is calculated internally*/
     class md_rs400_sensor_timestamp : public md_attribute_parser_base
     {
@@ -40,19 +40,23 @@ void librealsense::uvc_pu_option::set(float value)
                 throw invalid_value_exception(to_string() << "set_pu(id=" << std::to_string(_id) << ") failed!" << " Last Error: " << strerror(errno));
             _record(*this);
         });
+    _ep.invalidate_option_cache();
 }
 
 float librealsense::uvc_pu_option::query() const
 {
-    return static_cast<float>(_ep.invoke_powered(
-        [this](platform::uvc_device& dev)
-        {
-            int32_t value = 0;
-            if (!dev.get_pu(_id, value))
-                throw invalid_value_exception(to_string() << "get_pu(id=" << std::to_string(_id) << ") failed!" << " Last Error: " << strerror(errno));
+    return _cache.query([this]()
+    {
+        return static_cast<float>(_ep.invoke_powered(
+            [this](platform::uvc_device& dev)
+            {
+                int32_t value = 0;
+                if (!dev.get_pu(_id, value))
+                    throw invalid_value_exception(to_string() << "get_pu(id=" << std::to_string(_id) << ") failed!" << " Last Error: " << strerror(errno));
 
-            return static_cast<float>(value);
-        }));
+                return static_cast<float>(value);
+            }));
+    });
 }
 
 librealsense::option_range librealsense::uvc_pu_option::get_range() const
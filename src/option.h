@@ -61,6 +61,24 @@ namespace librealsense
         std::string _desc;
     };
 
+    // Read-only option whose value is queried anew on every call, for values that change while streaming
+    class readonly_callback_option : public readonly_option
+    {
+    public:
+        readonly_callback_option(std::string desc, std::function<float()> query, const option_range& range)
+            : _query(std::move(query)), _desc(std::move(desc)), _range(range) {}
+
+        float query() const override { return _query(); }
+        option_range get_range() const override { return _range; }
+        bool is_enabled() const override { return true; }
+
+        const char* get_description() const override { return _desc.c_str(); }
+    private:
+        std::function<float()> _query;
+        std::string _desc;
+        option_range _range;
+    };
+
     class option_base : public option
     {
     public:
@@ -144,6 +162,47 @@ namespace librealsense
         std::function<void(float)> _on_set;
     };
 
+    // Value of a UVC control last read by an option, reused until the sensor invalidates its option cache.
+    // Volatile controls, that the device changes by itself, are always read from the device
+    class uvc_option_cache
+    {
+    public:
+        explicit uvc_option_cache(const uvc_sensor& ep, bool is_volatile = false)
+            : _ep(ep), _volatile(is_volatile)
+        {}
+
+        void set_volatile(bool is_volatile) { _volatile = is_volatile; }
+        bool is_volatile() const { return _volatile; }
+
+        template<class T>
+        float query(T read) const
+        {
+            if (_volatile)
+                return read();
+
+            // A control set while reading invalidates the generation the value is stored with
+            auto generation = _ep.get_option_cache_generation();
+            {
+                std::lock_guard<std::mutex> lock(_mtx);
+                if (_generation == generation)
+                    return _value;
+            }
+
+            auto value = read();
+            std::lock_guard<std::mutex> lock(_mtx);
+            _value = value;
+            _generation = generation;
+            return value;
+        }
+
+    private:
+        const uvc_sensor& _ep;
+        std::atomic<bool> _volatile;
+        mutable std::mutex _mtx;
+        mutable float _value = 0;
+        mutable uint64_t _generation = 0;
+    };
+
     class uvc_pu_option : public option
     {
     public:
@@ -159,15 +218,18 @@ namespace librealsense
         }
 
         uvc_pu_option(uvc_sensor& ep, rs2_option id)
-            : _ep(ep), _id(id)
+            : _ep(ep), _id(id), _cache(ep, is_auto_controlled(id))
         {
         }
 
         uvc_pu_option(uvc_sensor& ep, rs2_option id, const std::map<float, std::string>& description_per_value)
-            : _ep(ep), _id(id), _description_per_value(description_per_value)
+            : _ep(ep), _id(id), _description_per_value(description_per_value), _cache(ep, is_auto_controlled(id))
         {
         }
 
+        // Volatile options are read from the device on every query
+        void set_volatile(bool is_volatile) { _cache.set_volatile(is_volatile); }
+
         const char* get_description() const override;
 
         const char* get_value_description(float val) const override
@@ -181,10 +243,17 @@ namespace librealsense
             _record = record_action;
         }
     private:
+        // Controls driven by the device auto exposure and auto white balance
+        static bool is_auto_controlled(rs2_option id)
+        {
+            return id == RS2_OPTION_EXPOSURE || id == RS2_OPTION_GAIN || id == RS2_OPTION_WHITE_BALANCE;
+        }
+
         uvc_sensor& _ep;
         rs2_option _id;
         const std::map<float, std::string> _description_per_value;
         std::function<void(const option &)> _record = [](const option &) {};
+        uvc_option_cache _cache;
     };
 
     template<typename T>
@@ -201,19 +270,23 @@ namespace librealsense
                         throw invalid_value_exception(to_string() << "set_xu(id=" << std::to_string(_id) << ") failed!" << " Last Error: " << strerror(errno));
                     _recording_function(*this);
                 });
+            _ep.invalidate_option_cache();
         }
 
         float query() const override
         {
-            return static_cast<float>(_ep.invoke_powered(
-                [this](platform::uvc_device& dev)
-                {
-                    T t;
-                    if (!dev.get_xu(_xu, _id, reinterpret_cast<uint8_t*>(&t), sizeof(T)))
-                        throw invalid_value_exception(to_string() << "get_xu(id=" << std::to_string(_id) << ") failed!" << " Last Error: " << strerror(errno));
-
-                    return static_cast<float>(t);
-                }));
+            return _cache.query([this]()
+            {
+                return static_cast<float>(_ep.invoke_powered(
+                    [this](platform::uvc_device& dev)
+                    {
+                        T t;
+                        if (!dev.get_xu(_xu, _id, reinterpret_cast<uint8_t*>(&t), sizeof(T)))
+                            throw invalid_value_exception(to_string() << "get_xu(id=" << std::to_string(_id) << ") failed!" << " Last Error: " << strerror(errno));
+
+                        return static_cast<float>(t);
+                    }));
+            });
         }
 
         option_range get_range() const override
@@ -239,9 +312,12 @@ namespace librealsense
         bool is_enabled() const override { return true; }
 
         uvc_xu_option(uvc_sensor& ep, platform::extension_unit xu, uint8_t id, std::string description)
-            : _ep(ep), _xu(xu), _id(id), _desciption(std::move(description))
+            : _ep(ep), _xu(xu), _id(id), _desciption(std::move(description)), _cache(ep)
         {}
 
+        // Volatile options are read from the device on every query
+        void set_volatile(bool is_volatile) { _cache.set_volatile(is_volatile); }
+
         const char* get_description() const override
         {
             return _desciption.c_str();
@@ -256,6 +332,7 @@ namespace librealsense
         uint8_t             _id;
         std::string         _desciption;
         std::function<void(const option&)> _recording_function = [](const option&) {};
+        uvc_option_cache    _cache;
     };
 
     inline std::string hexify(unsigned char n)
@@ -2,6 +2,8 @@
 // Copyright(c) 2015 Intel Corporation. All Rights Reserved.
 
 #include <algorithm>
+#include <fstream>
+#include <set>
 #include "proc/synthetic-stream.h"
 #include "proc/syncer-processing-block.h"
 #include "pipeline.h"
@@ -11,8 +13,9 @@
 
 namespace librealsense
 {
-    pipeline_processing_block::pipeline_processing_block(const std::vector<int>& streams_to_aggregate) :
-        _queue(new single_consumer_queue<frame_holder>(1)),
+    pipeline_processing_block::pipeline_processing_block(const std::vector<int>& streams_to_aggregate,
+                                                         std::shared_ptr<single_consumer_queue<frame_holder>> output) :
+        _queue(output ? output : std::make_shared<single_consumer_queue<frame_holder>>(1)),
         _streams_ids(streams_to_aggregate)
     {
         auto processing_callback = [&](frame_holder frame, synthetic_source_interface* source)
@@ -54,7 +57,9 @@ namespace librealsense
                 LOG_ERROR("Failed to allocate composite frame");
                 return;
             }
-            _queue->enqueue(fref);
+            frame_holder dropped;
+            if (_queue->enqueue(fref, &dropped))
+                record_queue_overflow(dropped.frame);
         }
         else
         {
@@ -121,7 +126,7 @@ namespace librealsense
         _playback_loop = repeat_playback;
     }
 
-    void pipeline_config::enable_record_to_file(const std::string& file)
+    void pipeline_config::enable_record_to_file(const std::string& file, rs2_record_compression compression, uint32_t chunk_size, uint32_t compression_threads)
     {
         std::lock_guard<std::mutex> lock(_mtx);
         if (!_device_request.filename.empty())
@@ -130,6 +135,23 @@ namespace librealsense
         }
         _resolved_profile.reset();
         _device_request.record_output = file;
+        _device_request.record_compression = compression;
+        _device_request.record_chunk_size = chunk_size;
+        _device_request.record_compression_threads = compression_threads;
+    }
+
+    void pipeline_config::enable_profile_cache(const std::string& file)
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        _resolved_profile.reset();
+        _profile_cache_file = file;
+    }
+
+    void pipeline_config::enable_bandwidth_aware_resolve(bool enable)
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        _resolved_profile.reset();
+        _bandwidth_aware = enable;
     }
 
     std::shared_ptr<pipeline_profile> pipeline_config::get_cached_resolved_profile()
@@ -138,6 +160,34 @@ namespace librealsense
         return _resolved_profile;
     }
 
+    std::string pipeline_config::get_signature()
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        return unsafe_get_signature();
+    }
+
+    bool pipeline_config::is_live_config()
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        return _device_request.filename.empty() && _device_request.record_output.empty();
+    }
+
+    std::string pipeline_config::unsafe_get_signature() const
+    {
+        // Two configs with the same signature resolve to the same pipeline profile on the same device
+        std::stringstream ss;
+        ss << "serial=" << _device_request.serial << ";file=" << _device_request.filename
+           << ";record=" << _device_request.record_output << ";compression=" << _device_request.record_compression
+           << ";chunk=" << _device_request.record_chunk_size << ";threads=" << _device_request.record_compression_threads << ";all=" << _enable_all_streams << ";bandwidth=" << _bandwidth_aware << ";";
+        for (auto&& req : _stream_requests)
+        {
+            auto r = req.second;
+            ss << r.stream << "," << r.stream_index << "," << r.width << "," << r.height << ","
+               << r.format << "," << r.fps << ";";
+        }
+        return ss.str();
+    }
+
     void pipeline_config::disable_stream(rs2_stream stream, int index)
     {
         std::lock_guard<std::mutex> lock(_mtx);
@@ -167,6 +217,21 @@ namespace librealsense
 
     std::shared_ptr<pipeline_profile> pipeline_config::resolve(std::shared_ptr<device_interface> dev)
     {
+        if (_bandwidth_aware && _device_request.filename.empty())
+            return resolve_within_bandwidth({ dev }).front();
+
+        return resolve_streams(dev, 0);
+    }
+
+    static bool is_video_stream(rs2_stream stream)
+    {
+        return stream == RS2_STREAM_DEPTH || stream == RS2_STREAM_COLOR || stream == RS2_STREAM_INFRARED ||
+               stream == RS2_STREAM_FISHEYE || stream == RS2_STREAM_CONFIDENCE;
+    }
+
+    std::shared_ptr<pipeline_profile> pipeline_config::resolve_streams(std::shared_ptr<device_interface> dev, uint32_t max_video_fps)
+    {
+        // max_video_fps limits the frame rate of video streams that were not requested at a specific frame rate, 0 for no limit
         util::config config;
 
         //if the user requested all streams
@@ -178,24 +243,444 @@ namespace librealsense
                 auto profiles = sub.get_stream_profiles(PROFILE_TAG_SUPERSET);
                 config.enable_streams(profiles);
             }
-            return std::make_shared<pipeline_profile>(dev, config, _device_request.record_output);
+            return std::make_shared<pipeline_profile>(dev, config, _device_request.record_output, _device_request.record_compression, _device_request.record_chunk_size, _device_request.record_compression_threads);
         }
 
         //If the user did not request anything, give it the default, on playback all recorded streams are marked as default.
         if (_stream_requests.empty())
         {
             auto default_profiles = get_default_configuration(dev);
-            config.enable_streams(default_profiles);
-            return std::make_shared<pipeline_profile>(dev, config, _device_request.record_output);
+            if (max_video_fps == 0)
+            {
+                config.enable_streams(default_profiles);
+                return std::make_shared<pipeline_profile>(dev, config, _device_request.record_output, _device_request.record_compression, _device_request.record_chunk_size, _device_request.record_compression_threads);
+            }
+
+            //Keep the default streams and resolutions, at the limited frame rate
+            for (auto&& p : default_profiles)
+            {
+                if (auto vid = dynamic_cast<video_stream_profile_interface*>(p.get()))
+                {
+                    config.enable_stream(p->get_stream_type(), p->get_stream_index(), vid->get_width(), vid->get_height(),
+                                         p->get_format(), std::min(p->get_framerate(), max_video_fps));
+                }
+                else
+                {
+                    config.enable_stream(p->get_stream_type(), p->get_stream_index(), 0, 0, p->get_format(), p->get_framerate());
+                }
+            }
+            return std::make_shared<pipeline_profile>(dev, config, _device_request.record_output, _device_request.record_compression, _device_request.record_chunk_size, _device_request.record_compression_threads);
         }
 
         //Enabled requested streams
         for (auto&& req : _stream_requests)
         {
             auto r = req.second;
+            if (max_video_fps != 0 && r.fps == 0 && is_video_stream(r.stream))
+                r.fps = max_video_fps;
             config.enable_stream(r.stream, r.stream_index, r.width, r.height, r.format, r.fps);
         }
-        return std::make_shared<pipeline_profile>(dev, config, _device_request.record_output);
+        return std::make_shared<pipeline_profile>(dev, config, _device_request.record_output, _device_request.record_compression, _device_request.record_chunk_size, _device_request.record_compression_threads);
+    }
+
+    /*
+        Bandwidth model of the bandwidth aware resolve mode.
+        A device is attached to the USB bus named by the unique id of its UVC interfaces ("<bus>-<port path>-<address>"
+        on Linux). Devices with a unique id of another form are considered to have a link of their own, and devices with
+        an unknown link speed are not limited.
+        The load of a bus is the sum of width * height * bytes-per-pixel * fps of the video streams and
+        sample size * rate of the motion streams, of all the devices on the bus.
+    */
+    static const double USB2_PAYLOAD_BYTES_PER_SEC = 35e6;     // Practical payload of a 480Mbps high-speed bus
+    static const double USB3_PAYLOAD_BYTES_PER_SEC = 350e6;    // Practical payload of a 5Gbps super-speed bus
+    static const double USB3_1_PAYLOAD_BYTES_PER_SEC = 700e6;  // Practical payload of a 10Gbps super-speed+ bus
+    static const double HID_SAMPLE_BYTES = 32;                 // Size of a single motion sample report, including its timestamp
+
+    struct usb_link
+    {
+        std::string bus;
+        platform::usb_spec spec;
+    };
+
+    static usb_link get_usb_link(const std::shared_ptr<device_interface>& dev)
+    {
+        usb_link link{ "", platform::usb_undefined };
+        for (auto&& info : dev->get_device_data().uvc_devices)
+        {
+            if (info.conn_spec > link.spec)
+                link.spec = info.conn_spec;
+
+            if (link.bus.empty() && !info.unique_id.empty())
+            {
+                auto sep = info.unique_id.find('-');
+                auto bus = info.unique_id.substr(0, sep);
+                if (sep != std::string::npos && !bus.empty() && std::all_of(bus.begin(), bus.end(), ::isdigit))
+                    link.bus = "bus " + bus;
+                else
+                    link.bus = "link " + info.unique_id;
+            }
+        }
+
+        if (link.spec == platform::usb_undefined)
+            link.bus.clear();
+        return link;
+    }
+
+    static double get_usb_link_capacity(platform::usb_spec spec)
+    {
+        if (spec >= platform::usb3_1_type) return USB3_1_PAYLOAD_BYTES_PER_SEC;
+        if (spec >= platform::usb3_type) return USB3_PAYLOAD_BYTES_PER_SEC;
+        return USB2_PAYLOAD_BYTES_PER_SEC;
+    }
+
+    static double get_stream_bandwidth(const std::shared_ptr<stream_profile_interface>& p)
+    {
+        auto vid = dynamic_cast<video_stream_profile_interface*>(p.get());
+        if (!vid)
+            return HID_SAMPLE_BYTES * p->get_framerate();
+
+        auto bpp = 0;
+        switch (p->get_format())
+        {
+        // Color formats are unpacked on the host from 16 bits per pixel YUY2 / UYVY
+        case RS2_FORMAT_RGB8:
+        case RS2_FORMAT_BGR8:
+        case RS2_FORMAT_RGBA8:
+        case RS2_FORMAT_BGRA8: bpp = 16; break;
+        default: bpp = get_image_bpp(p->get_format()); break;
+        }
+        return double(vid->get_width()) * vid->get_height() * bpp / 8 * p->get_framerate();
+    }
+
+    static double get_profile_bandwidth(const pipeline_profile& profile)
+    {
+        double bandwidth = 0;
+        for (auto&& p : profile.get_active_streams())
+            bandwidth += get_stream_bandwidth(p);
+        return bandwidth;
+    }
+
+    static uint32_t get_max_video_fps(const pipeline_profile& profile)
+    {
+        uint32_t fps = 0;
+        for (auto&& p : profile.get_active_streams())
+            if (dynamic_cast<video_stream_profile_interface*>(p.get()))
+                fps = std::max(fps, p->get_framerate());
+        return fps;
+    }
+
+    std::vector<std::shared_ptr<pipeline_profile>> pipeline_config::resolve_within_bandwidth(const std::vector<std::shared_ptr<device_interface>>& devices)
+    {
+        struct device_load
+        {
+            std::shared_ptr<device_interface> dev;
+            usb_link link;
+            std::vector<uint32_t> rates; // Frame rates of the video profiles of the device, in descending order
+            std::shared_ptr<pipeline_profile> profile;
+            double bandwidth;
+        };
+
+        std::vector<device_load> loads;
+        for (auto&& dev : devices)
+        {
+            device_load load;
+            load.dev = dev;
+            load.link = get_usb_link(dev);
+            load.profile = resolve_streams(dev, 0);
+            load.bandwidth = get_profile_bandwidth(*load.profile);
+
+            std::set<uint32_t> rates;
+            for (size_t i = 0; i < dev->get_sensors_count(); ++i)
+                for (auto&& p : dev->get_sensor(i).get_stream_profiles())
+                    if (dynamic_cast<video_stream_profile_interface*>(p.get()))
+                        rates.insert(p->get_framerate());
+            load.rates.assign(rates.rbegin(), rates.rend());
+            loads.push_back(load);
+        }
+
+        // Starting from the best quality profiles, lower the frame rate of the most demanding device of an
+        // over-subscribed bus, one step at a time, until every bus fits its capacity
+        while (true)
+        {
+            std::map<std::string, double> bus_load;
+            std::map<std::string, double> bus_capacity;
+            for (auto&& l : loads)
+            {
+                if (l.link.bus.empty())
+                    continue;
+                bus_load[l.link.bus] += l.bandwidth;
+                bus_capacity[l.link.bus] = std::max(bus_capacity[l.link.bus], get_usb_link_capacity(l.link.spec));
+            }
+
+            auto over = std::find_if(bus_load.begin(), bus_load.end(), [&](const std::pair<const std::string, double>& kvp)
+            {
+                return kvp.second > bus_capacity[kvp.first];
+            });
+            if (over == bus_load.end())
+                break;
+
+            std::vector<device_load*> on_bus;
+            for (auto&& l : loads)
+                if (l.link.bus == over->first)
+                    on_bus.push_back(&l);
+            std::sort(on_bus.begin(), on_bus.end(), [](const device_load* a, const device_load* b) { return a->bandwidth > b->bandwidth; });
+
+            bool downgraded = false;
+            for (auto l : on_bus)
+            {
+                auto current_fps = get_max_video_fps(*l->profile);
+                for (auto fps : l->rates)
+                {
+                    if (fps >= current_fps)
+                        continue;
+                    try
+                    {
+                        auto profile = resolve_streams(l->dev, fps);
+                        auto bandwidth = get_profile_bandwidth(*profile);
+                        if (bandwidth >= l->bandwidth)
+                            continue;
+
+                        LOG_INFO("Bandwidth aware resolve - lowered video frame rate to " << fps << " on " << over->first
+                            << ", " << over->second / 1e6 << " MB/s requested out of " << bus_capacity[over->first] / 1e6 << " MB/s");
+                        l->profile = profile;
+                        l->bandwidth = bandwidth;
+                        downgraded = true;
+                        break;
+                    }
+                    catch (const std::exception& e)
+                    {
+                        LOG_DEBUG("Bandwidth aware resolve - config can not be resolved at " << fps << " FPS. " << e.what());
+                    }
+                }
+                if (downgraded)
+                    break;
+            }
+
+            if (!downgraded)
+            {
+                // Nothing left to lower, point at the most demanding stream of the bus
+                std::shared_ptr<stream_profile_interface> heaviest;
+                device_load* owner = nullptr;
+                for (auto l : on_bus)
+                {
+                    for (auto&& p : l->profile->get_active_streams())
+                    {
+                        if (!heaviest || get_stream_bandwidth(p) > get_stream_bandwidth(heaviest))
+                        {
+                            heaviest = p;
+                            owner = l;
+                        }
+                    }
+                }
+
+                std::stringstream request;
+                if (heaviest)
+                {
+                    request << heaviest->get_stream_type() << " " << heaviest->get_stream_index() << " ";
+                    if (auto vid = dynamic_cast<video_stream_profile_interface*>(heaviest.get()))
+                        request << vid->get_width() << "x" << vid->get_height() << " ";
+                    request << heaviest->get_format() << " " << heaviest->get_framerate() << " FPS";
+                    if (owner->dev->supports_info(RS2_CAMERA_INFO_SERIAL_NUMBER))
+                        request << " of device " << owner->dev->get_info(RS2_CAMERA_INFO_SERIAL_NUMBER);
+                }
+                throw std::runtime_error(to_string() << "Failed to resolve request. Requested streams need "
+                    << over->second / 1e6 << " MB/s on USB " << over->first << " that carries up to "
+                    << bus_capacity[over->first] / 1e6 << " MB/s, downgrade the request for " << request.str());
+            }
+        }
+
+        std::vector<std::shared_ptr<pipeline_profile>> profiles;
+        for (auto&& l : loads)
+            profiles.push_back(l.profile);
+        return profiles;
+    }
+
+    /*
+        The profile cache file holds one resolved profile per line, in the form:
+        <config signature>|<usb unique id>|<serial>|<firmware version>|<stream,index,width,height,format,fps>|...
+        An entry is used only if a device with the same unique id, serial number and firmware version is connected.
+    */
+
+    static std::vector<profile_cache_entry> read_profile_cache(const std::string& file)
+    {
+        std::vector<profile_cache_entry> entries;
+        std::ifstream in(file);
+        std::string line;
+        while (std::getline(in, line))
+        {
+            std::stringstream ss(line);
+            profile_cache_entry entry;
+            if (!std::getline(ss, entry.signature, '|') || !std::getline(ss, entry.unique_id, '|') ||
+                !std::getline(ss, entry.serial, '|') || !std::getline(ss, entry.firmware, '|'))
+                continue;
+
+            bool valid = true;
+            std::string field;
+            while (std::getline(ss, field, '|'))
+            {
+                int stream, index, width, height, format, fps;
+                char sep;
+                std::stringstream fs(field);
+                if (!(fs >> stream >> sep >> index >> sep >> width >> sep >> height >> sep >> format >> sep >> fps))
+                {
+                    valid = false;
+                    break;
+                }
+                entry.requests.push_back({ static_cast<rs2_stream>(stream), index, static_cast<uint32_t>(width),
+                                           static_cast<uint32_t>(height), static_cast<rs2_format>(format), static_cast<uint32_t>(fps) });
+            }
+            if (valid && !entry.requests.empty())
+                entries.push_back(entry);
+        }
+        return entries;
+    }
+
+    static void write_profile_cache(const std::string& file, const std::vector<profile_cache_entry>& entries)
+    {
+        std::ofstream out(file, std::ios::trunc);
+        for (auto&& entry : entries)
+        {
+            out << entry.signature << "|" << entry.unique_id << "|" << entry.serial << "|" << entry.firmware;
+            for (auto&& r : entry.requests)
+            {
+                out << "|" << r.stream << "," << r.stream_index << "," << r.width << "," << r.height << ","
+                    << r.format << "," << r.fps;
+            }
+            out << std::endl;
+        }
+        if (!out)
+            LOG_WARNING("Failed to write pipeline profile cache to " << file);
+    }
+
+    static std::string get_usb_unique_id(const std::shared_ptr<device_interface>& dev)
+    {
+        auto group = dev->get_device_data();
+        if (group.uvc_devices.empty())
+            return "";
+        return group.uvc_devices.front().unique_id;
+    }
+
+    std::shared_ptr<pipeline_profile> pipeline_config::resolve_from_profile_cache(std::shared_ptr<pipeline> pipe)
+    {
+        auto signature = unsafe_get_signature();
+        auto entries = read_profile_cache(_profile_cache_file);
+        if (entries.empty())
+            return nullptr;
+
+        // Only the device recorded in the cache is created, instead of creating and matching every connected device
+        auto devs = pipe->get_context()->query_devices(RS2_PRODUCT_LINE_ANY);
+        for (auto&& entry : entries)
+        {
+            if (entry.signature != signature)
+                continue;
+
+            if (auto profile = unsafe_resolve_profile_cache_entry(devs, entry))
+                return profile;
+        }
+        return nullptr;
+    }
+
+    std::shared_ptr<pipeline_profile> pipeline_config::resolve_profile_cache_entry(std::shared_ptr<pipeline> pipe, const profile_cache_entry& entry)
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        if (entry.signature != unsafe_get_signature())
+            return nullptr;
+
+        auto devs = pipe->get_context()->query_devices(RS2_PRODUCT_LINE_ANY);
+        return unsafe_resolve_profile_cache_entry(devs, entry);
+    }
+
+    std::shared_ptr<pipeline_profile> pipeline_config::unsafe_resolve_profile_cache_entry(const std::vector<std::shared_ptr<device_info>>& devs,
+                                                                                         const profile_cache_entry& entry)
+    {
+        for (auto&& dev_info : devs)
+        {
+            auto group = dev_info->get_device_data();
+            auto it = std::find_if(group.uvc_devices.begin(), group.uvc_devices.end(), [&](const platform::uvc_device_info& info)
+            {
+                return info.unique_id == entry.unique_id;
+            });
+            if (it == group.uvc_devices.end())
+                continue;
+
+            try
+            {
+                auto dev = dev_info->create_device(true);
+                if (!dev->supports_info(RS2_CAMERA_INFO_SERIAL_NUMBER) || dev->get_info(RS2_CAMERA_INFO_SERIAL_NUMBER) != entry.serial ||
+                    !dev->supports_info(RS2_CAMERA_INFO_FIRMWARE_VERSION) || dev->get_info(RS2_CAMERA_INFO_FIRMWARE_VERSION) != entry.firmware)
+                {
+                    LOG_DEBUG("Pipeline profile cache entry for device " << entry.serial << " is stale");
+                    continue;
+                }
+
+                util::config config;
+                for (auto&& r : entry.requests)
+                    config.enable_stream(r.stream, r.stream_index, r.width, r.height, r.format, r.fps);
+                return std::make_shared<pipeline_profile>(dev, config, _device_request.record_output, _device_request.record_compression, _device_request.record_chunk_size, _device_request.record_compression_threads);
+            }
+            catch (const std::exception& e)
+            {
+                LOG_DEBUG("Pipeline profile cache entry for device " << entry.serial << " can not be resolved. " << e.what());
+            }
+        }
+        return nullptr;
+    }
+
+    std::shared_ptr<profile_cache_entry> pipeline_config::get_profile_cache_entry(std::shared_ptr<pipeline_profile> profile)
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        return unsafe_get_profile_cache_entry(profile);
+    }
+
+    std::shared_ptr<profile_cache_entry> pipeline_config::unsafe_get_profile_cache_entry(std::shared_ptr<pipeline_profile> profile)
+    {
+        auto dev = profile->get_device();
+        auto entry = std::make_shared<profile_cache_entry>();
+        entry->signature = unsafe_get_signature();
+        entry->unique_id = get_usb_unique_id(dev);
+        if (entry->unique_id.empty() ||
+            !dev->supports_info(RS2_CAMERA_INFO_SERIAL_NUMBER) || !dev->supports_info(RS2_CAMERA_INFO_FIRMWARE_VERSION))
+            return nullptr;
+
+        entry->serial = dev->get_info(RS2_CAMERA_INFO_SERIAL_NUMBER);
+        entry->firmware = dev->get_info(RS2_CAMERA_INFO_FIRMWARE_VERSION);
+        for (auto&& kvp : profile->_multistream.get_profiles())
+        {
+            auto p = kvp.second;
+            util::config::request_type r{ p->get_stream_type(), p->get_stream_index(), 0, 0, p->get_format(), p->get_framerate() };
+            if (auto vid = dynamic_cast<video_stream_profile_interface*>(p.get()))
+            {
+                r.width = vid->get_width();
+                r.height = vid->get_height();
+            }
+            entry->requests.push_back(r);
+        }
+        return entry;
+    }
+
+    void pipeline_config::update_profile_cache(std::shared_ptr<pipeline_profile> profile)
+    {
+        if (_profile_cache_file.empty() || !_device_request.filename.empty())
+            return;
+
+        try
+        {
+            auto entry = unsafe_get_profile_cache_entry(profile);
+            if (!entry)
+                return;
+
+            auto entries = read_profile_cache(_profile_cache_file);
+            entries.erase(std::remove_if(entries.begin(), entries.end(), [&](const profile_cache_entry& e)
+            {
+                return e.signature == entry->signature && e.serial == entry->serial;
+            }), entries.end());
+            entries.push_back(*entry);
+            write_profile_cache(_profile_cache_file, entries);
+        }
+        catch (const std::exception& e)
+        {
+            LOG_WARNING("Failed to update pipeline profile cache. " << e.what());
+        }
     }
 
     std::shared_ptr<pipeline_profile> pipeline_config::resolve(std::shared_ptr<pipeline> pipe, const std::chrono::milliseconds& timeout)
@@ -203,11 +688,20 @@ namespace librealsense
         std::lock_guard<std::mutex> lock(_mtx);
         _resolved_profile.reset();
 
+        //Try the profile cache first, it skips looking for a device that satisfies the request
+        if (!_profile_cache_file.empty() && _device_request.filename.empty())
+        {
+            _resolved_profile = resolve_from_profile_cache(pipe);
+            if (_resolved_profile)
+                return _resolved_profile;
+        }
+
         //Resolve the the device that was specified by the user, this call will wait in case the device is not availabe.
         auto requested_device = resolve_device_requests(pipe, timeout);
         if (requested_device != nullptr)
         {
             _resolved_profile = resolve(requested_device);
+            update_profile_cache(_resolved_profile);
             return _resolved_profile;
         }
 
@@ -219,6 +713,7 @@ namespace librealsense
             {
                 auto dev = dev_info->create_device(true);
                 _resolved_profile = resolve(dev);
+                update_profile_cache(_resolved_profile);
                 return _resolved_profile;
             }
             catch (const std::exception& e)
@@ -232,6 +727,7 @@ namespace librealsense
         if (dev != nullptr)
         {
             _resolved_profile = resolve(dev);
+            update_profile_cache(_resolved_profile);
             return _resolved_profile;
         }
 
@@ -403,21 +899,15 @@ namespace librealsense
 
     void pipeline::unsafe_start(std::shared_ptr<pipeline_config> conf)
     {
-        std::shared_ptr<pipeline_profile> profile = nullptr;
-        //first try to get the previously resolved profile (if exists)
-        auto cached_profile = conf->get_cached_resolved_profile();
-        if (cached_profile)
-        {
-            profile = cached_profile;
-        }
-        else
+        auto resolve = [&]()
         {
+            std::shared_ptr<pipeline_profile> resolved = nullptr;
             const int NUM_TIMES_TO_RETRY = 3;
             for (int i = 1; i <= NUM_TIMES_TO_RETRY; i++)
             {
                 try
                 {
-                    profile = conf->resolve(shared_from_this(), std::chrono::seconds(5));
+                    resolved = conf->resolve(shared_from_this(), std::chrono::seconds(5));
                     break;
                 }
                 catch (...)
@@ -426,19 +916,43 @@ namespace librealsense
                         throw;
                 }
             }
+            return resolved;
+        };
+
+        std::shared_ptr<pipeline_profile> profile = nullptr;
+        bool is_warm_restart = false;
+        //first try to get the previously resolved profile (if exists)
+        auto cached_profile = conf->get_cached_resolved_profile();
+        if (cached_profile)
+        {
+            profile = cached_profile;
+        }
+        else if (auto warm_profile = get_warm_profile(conf))
+        {
+            //warm restart - the config did not change since the last stop(), request the same streams from the same device
+            profile = warm_profile;
+            is_warm_restart = true;
+        }
+        else
+        {
+            profile = resolve();
         }
 
         assert(profile);
         assert(profile->_multistream.get_profiles().size() > 0);
 
-        std::vector<int> unique_ids;
-        for (auto&& s : profile->get_active_streams())
+        auto create_pipeline_process = [this](std::shared_ptr<pipeline_profile> profile)
         {
-            unique_ids.push_back(s->get_unique_id());
-        }
+            std::vector<int> unique_ids;
+            for (auto&& s : profile->get_active_streams())
+            {
+                unique_ids.push_back(s->get_unique_id());
+            }
+            _pipeline_process = std::unique_ptr<pipeline_processing_block>(new pipeline_processing_block(unique_ids));
+        };
 
         _syncer = std::unique_ptr<syncer_process_unit>(new syncer_process_unit());
-        _pipeline_process = std::unique_ptr<pipeline_processing_block>(new pipeline_processing_block(unique_ids));
+        create_pipeline_process(profile);
 
         auto pipeline_process_callback = [&](frame_holder fref)
         {
@@ -484,12 +998,55 @@ namespace librealsense
         }
 
         _dispatcher.start();
-        profile->_multistream.open();
-        profile->_multistream.start(syncer_callback);
+        try
+        {
+            start_streaming(*profile, syncer_callback);
+        }
+        catch (const std::exception& e)
+        {
+            if (!is_warm_restart)
+                throw;
+
+            //The profile of the previous session may no longer apply to the device (e.g. after a hardware reset)
+            LOG_WARNING("Failed to restart the previous pipeline profile, resolving the config again. " << e.what());
+            profile = resolve();
+            create_pipeline_process(profile);
+            start_streaming(*profile, syncer_callback);
+        }
         _active_profile = profile;
         _prev_conf = std::make_shared<pipeline_config>(*conf);
     }
 
+    void pipeline::start_streaming(pipeline_profile& profile, frame_callback_ptr callback)
+    {
+        profile._multistream.open();
+        try
+        {
+            profile._multistream.start(callback);
+        }
+        catch (...)
+        {
+            try
+            {
+                profile._multistream.close();
+            }
+            catch (...) {} // The error of start is the one reported
+            throw;
+        }
+    }
+
+    std::shared_ptr<pipeline_profile> pipeline::get_warm_profile(std::shared_ptr<pipeline_config> conf)
+    {
+        auto entry = _warm_entry;
+        _warm_entry.reset();
+
+        if (!entry || !conf->is_live_config())
+            return nullptr;
+
+        //The device is created again, a device that was disconnected or reset since stop() is not reused
+        return conf->resolve_profile_cache_entry(shared_from_this(), *entry);
+    }
+
     void pipeline::stop()
     {
         std::lock_guard<std::mutex> lock(_mtx);
@@ -519,6 +1076,16 @@ namespace librealsense
             {
             } // Stop will throw if device was disconnected. TODO - refactoring anticipated
         }
+        //Keep only the resolved streams of a live device, the device itself is released with the profile
+        _warm_entry.reset();
+        if (_active_profile && _prev_conf && _prev_conf->is_live_config())
+        {
+            try
+            {
+                _warm_entry = _prev_conf->get_profile_cache_entry(_active_profile);
+            }
+            catch (...) {} // The device may have been disconnected, the next start() resolves the config again
+        }
         _active_profile.reset();
         _syncer.reset();
         _pipeline_process.reset();
@@ -620,6 +1187,304 @@ namespace librealsense
     }
 
 
+    /*
+     .___  ___.  __    __   __      .___________.  __
+     |   \/   | |  |  |  | |  |     |           | |  |
+     |  \  /  | |  |  |  | |  |     `---|  |----` |  |
+     |  |\/|  | |  |  |  | |  |         |  |      |  |
+     |  |  |  | |  `--'  | |  `----.    |  |      |  |
+     |__|  |__|  \______/  |_______|    |__|      |__|
+    */
+
+    // Frames of one device are always synced by the same worker, so the pool size only bounds the thread count
+    const size_t MULTI_PIPELINE_WORKER_QUEUE_SIZE = 32;
+    const unsigned int MULTI_PIPELINE_FRAMESETS_PER_DEVICE = 2;
+
+    void multi_pipeline::frameset_queues::notify()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ++generation;
+        }
+        cv.notify_all();
+    }
+
+    bool multi_pipeline::frameset_queues::try_dequeue(frame_holder* frame)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        // Starting from the queue after the one served last, so that every device gets its turn
+        for (size_t i = 0; i < queues.size(); ++i)
+        {
+            auto index = (next + i) % queues.size();
+            if (queues[index]->try_dequeue(frame))
+            {
+                next = index + 1;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool multi_pipeline::frameset_queues::dequeue(frame_holder* frame, unsigned int timeout_ms)
+    {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+        while (true)
+        {
+            uint64_t seen;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                seen = generation;
+            }
+            if (try_dequeue(frame))
+                return true;
+
+            std::unique_lock<std::mutex> lock(mutex);
+            if (!cv.wait_until(lock, deadline, [&]() { return stopped || generation != seen; }) || stopped)
+                return false;
+        }
+    }
+
+    multi_pipeline::multi_pipeline(std::shared_ptr<librealsense::context> ctx)
+        : _ctx(ctx)
+    {}
+
+    multi_pipeline::~multi_pipeline()
+    {
+        try
+        {
+            unsafe_stop();
+        }
+        catch (...) {}
+    }
+
+    void multi_pipeline::start(std::shared_ptr<pipeline_config> conf)
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        if (!_sessions.empty())
+        {
+            throw librealsense::wrong_api_call_sequence_exception("start() cannot be called before stop()");
+        }
+
+        std::vector<std::shared_ptr<pipeline_profile>> profiles;
+        std::vector<std::shared_ptr<device_interface>> devices;
+        {
+            std::lock_guard<std::mutex> conf_lock(conf->_mtx);
+            if (!conf->_device_request.filename.empty() || !conf->_device_request.record_output.empty())
+            {
+                throw librealsense::invalid_value_exception("multi_pipeline supports live devices only, use a pipeline for playback and recording");
+            }
+
+            for (auto&& dev_info : _ctx->query_devices(RS2_PRODUCT_LINE_ANY))
+            {
+                try
+                {
+                    auto dev = dev_info->create_device(true);
+                    if (!conf->_device_request.serial.empty() &&
+                        (!dev->supports_info(RS2_CAMERA_INFO_SERIAL_NUMBER) || dev->get_info(RS2_CAMERA_INFO_SERIAL_NUMBER) != conf->_device_request.serial))
+                        continue;
+
+                    profiles.push_back(conf->resolve_streams(dev, 0));
+                    devices.push_back(dev);
+                }
+                catch (const std::exception& e)
+                {
+                    LOG_DEBUG("multi_pipeline - config can not be resolved for a device. " << e.what());
+                }
+            }
+
+            //The devices share the USB buses, so their bandwidth is resolved together
+            if (conf->_bandwidth_aware && !devices.empty())
+            {
+                profiles = conf->resolve_within_bandwidth(devices);
+            }
+        }
+
+        if (profiles.empty())
+        {
+            throw std::runtime_error("Failed to resolve request. No device found that satisfies all requirements");
+        }
+
+        auto max_workers = std::max(1u, std::thread::hardware_concurrency() / 2);
+        auto workers_count = std::min<size_t>(profiles.size(), max_workers);
+        for (size_t i = 0; i < workers_count; ++i)
+        {
+            _workers.emplace_back(new dispatcher(MULTI_PIPELINE_WORKER_QUEUE_SIZE));
+            _workers.back()->start();
+        }
+
+        _framesets = std::make_shared<frameset_queues>();
+
+        try
+        {
+            for (auto&& profile : profiles)
+            {
+                std::unique_ptr<device_session> session(new device_session());
+                session->profile = profile;
+                session->worker = _workers[_sessions.size() % _workers.size()].get();
+
+                std::vector<int> unique_ids;
+                for (auto&& s : profile->get_active_streams())
+                {
+                    unique_ids.push_back(s->get_unique_id());
+                }
+                // Keep up to two framesets per device, older framesets of the device are dropped
+                auto queue = std::make_shared<single_consumer_queue<frame_holder>>(MULTI_PIPELINE_FRAMESETS_PER_DEVICE);
+                {
+                    std::lock_guard<std::mutex> queues_lock(_framesets->mutex);
+                    _framesets->queues.push_back(queue);
+                }
+                session->syncer = std::unique_ptr<syncer_process_unit>(new syncer_process_unit());
+                session->aggregator = std::unique_ptr<pipeline_processing_block>(new pipeline_processing_block(unique_ids, queue));
+
+                auto aggregator = session->aggregator.get();
+                auto framesets = _framesets;
+                auto to_aggregator = [aggregator, framesets](frame_holder fref)
+                {
+                    aggregator->invoke(std::move(fref));
+                    framesets->notify();
+                };
+                session->syncer->set_output_callback({
+                    new internal_frame_callback<decltype(to_aggregator)>(to_aggregator),
+                    [](rs2_frame_callback* p) { p->release(); } });
+
+                // Sensor callbacks only hand the frame over to the worker of the device
+                auto syncer = session->syncer.get();
+                auto worker = session->worker;
+                auto to_worker = [syncer, worker](frame_holder fref)
+                {
+                    auto holder = std::make_shared<frame_holder>(std::move(fref));
+                    worker->invoke([syncer, holder](dispatcher::cancellable_timer t)
+                    {
+                        syncer->invoke(std::move(*holder));
+                    });
+                };
+                frame_callback_ptr sensors_callback = {
+                    new internal_frame_callback<decltype(to_worker)>(to_worker),
+                    [](rs2_frame_callback* p) { p->release(); } };
+
+                _sessions.push_back(std::move(session));
+                profile->_multistream.open();
+                try
+                {
+                    profile->_multistream.start(sensors_callback);
+                }
+                catch (...)
+                {
+                    profile->_multistream.close();
+                    _sessions.pop_back();
+                    throw;
+                }
+            }
+        }
+        catch (...)
+        {
+            unsafe_stop();
+            throw;
+        }
+    }
+
+    void multi_pipeline::stop()
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        if (_sessions.empty())
+        {
+            throw librealsense::wrong_api_call_sequence_exception("stop() cannot be called before start()");
+        }
+        unsafe_stop();
+    }
+
+    void multi_pipeline::unsafe_stop()
+    {
+        for (auto&& session : _sessions)
+        {
+            try
+            {
+                session->profile->_multistream.stop();
+            }
+            catch (...) {} // Stop will throw if device was disconnected
+        }
+
+        // No more frames arrive from the sensors, drop the pending work before closing
+        for (auto&& worker : _workers)
+        {
+            worker->stop();
+        }
+
+        for (auto&& session : _sessions)
+        {
+            try
+            {
+                session->profile->_multistream.close();
+            }
+            catch (...) {}
+        }
+
+        _sessions.clear();
+        _workers.clear();
+        if (_framesets)
+        {
+            {
+                std::lock_guard<std::mutex> lock(_framesets->mutex);
+                _framesets->stopped = true;
+            }
+            _framesets->cv.notify_all();
+            _framesets.reset();
+        }
+    }
+
+    std::vector<std::shared_ptr<pipeline_profile>> multi_pipeline::get_active_profiles() const
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        if (_sessions.empty())
+            throw librealsense::wrong_api_call_sequence_exception("get_active_profiles() can only be called between a start() and a following stop()");
+
+        std::vector<std::shared_ptr<pipeline_profile>> profiles;
+        for (auto&& session : _sessions)
+        {
+            profiles.push_back(session->profile);
+        }
+        return profiles;
+    }
+
+    frame_holder multi_pipeline::wait_for_frames(unsigned int timeout_ms)
+    {
+        frame_holder f;
+        if (try_wait_for_frames(&f, timeout_ms))
+        {
+            return f;
+        }
+        throw std::runtime_error(to_string() << "Frame didn't arrived within " << timeout_ms);
+    }
+
+    bool multi_pipeline::poll_for_frames(frame_holder* frame)
+    {
+        std::shared_ptr<frameset_queues> framesets;
+        {
+            std::lock_guard<std::mutex> lock(_mtx);
+            if (_sessions.empty())
+            {
+                throw librealsense::wrong_api_call_sequence_exception("poll_for_frames cannot be called before start()");
+            }
+            framesets = _framesets;
+        }
+        return framesets->try_dequeue(frame);
+    }
+
+    bool multi_pipeline::try_wait_for_frames(frame_holder* frame, unsigned int timeout_ms)
+    {
+        // The lock is not held while waiting, so that frames of all the devices can be consumed concurrently
+        std::shared_ptr<frameset_queues> framesets;
+        {
+            std::lock_guard<std::mutex> lock(_mtx);
+            if (_sessions.empty())
+            {
+                throw librealsense::wrong_api_call_sequence_exception("wait_for_frames cannot be called before start()");
+            }
+            framesets = _framesets;
+        }
+        return framesets->dequeue(frame, timeout_ms);
+    }
+
     /*
         .______   .______        ______    _______  __   __       _______
         |   _  \  |   _  \      /  __  \  |   ____||  | |  |     |   ____|
@@ -631,7 +1496,10 @@ namespace librealsense
 
     pipeline_profile::pipeline_profile(std::shared_ptr<device_interface> dev,
                                        util::config config,
-                                       const std::string& to_file) :
+                                       const std::string& to_file,
+                                       rs2_record_compression compression,
+                                       uint32_t chunk_size,
+                                       uint32_t compression_threads) :
         _dev(dev), _to_file(to_file)
     {
         if (!to_file.empty())
@@ -639,7 +1507,7 @@ namespace librealsense
             if (!dev)
                 throw librealsense::invalid_value_exception("Failed to create a pipeline_profile, device is null");
 
-            _dev = std::make_shared<record_device>(dev, std::make_shared<ros_writer>(to_file));
+            _dev = std::make_shared<record_device>(dev, std::make_shared<ros_writer>(to_file, compression, chunk_size, compression_threads));
         }
         _multistream = config.resolve(_dev.get());
     }
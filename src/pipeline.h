@@ -17,11 +17,12 @@ namespace librealsense
     {
         std::mutex _mutex;
         std::map<stream_id, frame_holder> _last_set;
-        std::unique_ptr<single_consumer_queue<frame_holder>> _queue;
+        std::shared_ptr<single_consumer_queue<frame_holder>> _queue;
         std::vector<int> _streams_ids;
         void handle_frame(frame_holder frame, synthetic_source_interface* source);
     public:
-        pipeline_processing_block(const std::vector<int>& streams_to_aggregate);
+        pipeline_processing_block(const std::vector<int>& streams_to_aggregate,
+                                  std::shared_ptr<single_consumer_queue<frame_holder>> output = nullptr);
         bool dequeue(frame_holder* item, unsigned int timeout_ms = 5000);
         bool try_dequeue(frame_holder* item);
     };
@@ -30,7 +31,9 @@ namespace librealsense
     class pipeline_profile
     {
     public:
-        pipeline_profile(std::shared_ptr<device_interface> dev, util::config config, const std::string& file = "");
+        pipeline_profile(std::shared_ptr<device_interface> dev, util::config config, const std::string& file = "",
+                         rs2_record_compression compression = RS2_RECORD_COMPRESSION_LZ4, uint32_t chunk_size = 0,
+                         uint32_t compression_threads = 0);
         std::shared_ptr<device_interface> get_device();
         stream_profiles get_active_streams() const;
         util::config::multistream _multistream;
@@ -39,6 +42,16 @@ namespace librealsense
         std::string _to_file;
     };
 
+    // Resolved streams of a config on a specific device, see pipeline_config::enable_profile_cache
+    struct profile_cache_entry
+    {
+        std::string signature;
+        std::string unique_id;
+        std::string serial;
+        std::string firmware;
+        std::vector<util::config::request_type> requests;
+    };
+
     class pipeline_config;
     class pipeline : public std::enable_shared_from_this<pipeline>
     {
@@ -63,6 +76,9 @@ namespace librealsense
         void unsafe_start(std::shared_ptr<pipeline_config> conf);
         void unsafe_stop();
         std::shared_ptr<pipeline_profile> unsafe_get_active_profile() const;
+        std::shared_ptr<pipeline_profile> get_warm_profile(std::shared_ptr<pipeline_config> conf);
+        // Opens and starts the streams of the profile, leaves them closed on failure
+        static void start_streaming(pipeline_profile& profile, frame_callback_ptr callback);
 
         std::shared_ptr<librealsense::context> _ctx;
         mutable std::mutex _mtx;
@@ -72,6 +88,9 @@ namespace librealsense
         std::unique_ptr<syncer_process_unit> _syncer;
         std::unique_ptr<pipeline_processing_block> _pipeline_process;
         std::shared_ptr<pipeline_config> _prev_conf;
+        // Streams of the last stopped session, resolved again on their device by the next start() with an identical config.
+        // Only the identity of the device is kept, so that stop() releases it and a reconnected device is created anew
+        std::shared_ptr<profile_cache_entry> _warm_entry;
         int _playback_stopped_token = -1;
         dispatcher _dispatcher;
     };
@@ -84,7 +103,10 @@ namespace librealsense
         void enable_all_stream();
         void enable_device(const std::string& serial);
         void enable_device_from_file(const std::string& file, bool repeat_playback);
-        void enable_record_to_file(const std::string& file);
+        void enable_record_to_file(const std::string& file, rs2_record_compression compression = RS2_RECORD_COMPRESSION_LZ4, uint32_t chunk_size = 0,
+                                   uint32_t compression_threads = 0);
+        void enable_profile_cache(const std::string& file);
+        void enable_bandwidth_aware_resolve(bool enable);
         void disable_stream(rs2_stream stream, int index = -1);
         void disable_all_streams();
         std::shared_ptr<pipeline_profile> resolve(std::shared_ptr<pipeline> pipe, const std::chrono::milliseconds& timeout = std::chrono::milliseconds(0));
@@ -92,7 +114,12 @@ namespace librealsense
         bool get_repeat_playback();
 
         //Non top level API
+        friend class multi_pipeline;
         std::shared_ptr<pipeline_profile> get_cached_resolved_profile();
+        std::string get_signature();
+        bool is_live_config();
+        std::shared_ptr<profile_cache_entry> get_profile_cache_entry(std::shared_ptr<pipeline_profile> profile);
+        std::shared_ptr<pipeline_profile> resolve_profile_cache_entry(std::shared_ptr<pipeline> pipe, const profile_cache_entry& entry);
 
         pipeline_config(const pipeline_config& other)
         {
@@ -102,6 +129,8 @@ namespace librealsense
             _stream_requests = other._stream_requests;
             _resolved_profile = nullptr;
             _playback_loop = other._playback_loop;
+            _profile_cache_file = other._profile_cache_file;
+            _bandwidth_aware = other._bandwidth_aware;
         }
     private:
         struct device_request
@@ -109,11 +138,21 @@ namespace librealsense
             std::string serial;
             std::string filename;
             std::string record_output;
+            rs2_record_compression record_compression = RS2_RECORD_COMPRESSION_LZ4;
+            uint32_t record_chunk_size = 0;
+            uint32_t record_compression_threads = 0;
         };
         std::shared_ptr<device_interface> get_or_add_playback_device(std::shared_ptr<pipeline> pipe, const std::string& file);
         std::shared_ptr<device_interface> resolve_device_requests(std::shared_ptr<pipeline> pipe, const std::chrono::milliseconds& timeout);
         stream_profiles get_default_configuration(std::shared_ptr<device_interface> dev);
         std::shared_ptr<pipeline_profile> resolve(std::shared_ptr<device_interface> dev);
+        std::shared_ptr<pipeline_profile> resolve_streams(std::shared_ptr<device_interface> dev, uint32_t max_video_fps);
+        std::vector<std::shared_ptr<pipeline_profile>> resolve_within_bandwidth(const std::vector<std::shared_ptr<device_interface>>& devices);
+        std::shared_ptr<pipeline_profile> resolve_from_profile_cache(std::shared_ptr<pipeline> pipe);
+        std::shared_ptr<pipeline_profile> unsafe_resolve_profile_cache_entry(const std::vector<std::shared_ptr<device_info>>& devs, const profile_cache_entry& entry);
+        std::shared_ptr<profile_cache_entry> unsafe_get_profile_cache_entry(std::shared_ptr<pipeline_profile> profile);
+        void update_profile_cache(std::shared_ptr<pipeline_profile> profile);
+        std::string unsafe_get_signature() const;
 
         device_request _device_request;
         std::map<std::pair<rs2_stream, int>, util::config::request_type> _stream_requests;
@@ -121,6 +160,59 @@ namespace librealsense
         bool _enable_all_streams = false;
         std::shared_ptr<pipeline_profile> _resolved_profile;
         bool _playback_loop;
+        std::string _profile_cache_file;
+        bool _bandwidth_aware = false;
     };
 
+
+    /**
+    * multi_pipeline class - streams every connected device that satisfies a single config.
+    * Synchronization of all the devices runs on one bounded pool of worker threads. Each device keeps its latest
+    * framesets in a bounded queue of its own, and the queues are served in turn, so that a faster device does not
+    * push the framesets of a slower one out.
+    */
+    class multi_pipeline
+    {
+    public:
+        explicit multi_pipeline(std::shared_ptr<librealsense::context> ctx);
+        ~multi_pipeline();
+        void start(std::shared_ptr<pipeline_config> conf);
+        void stop();
+        std::vector<std::shared_ptr<pipeline_profile>> get_active_profiles() const;
+        frame_holder wait_for_frames(unsigned int timeout_ms = 5000);
+        bool poll_for_frames(frame_holder* frame);
+        bool try_wait_for_frames(frame_holder* frame, unsigned int timeout_ms);
+
+    private:
+        struct device_session
+        {
+            std::shared_ptr<pipeline_profile> profile;
+            std::unique_ptr<syncer_process_unit> syncer;
+            std::unique_ptr<pipeline_processing_block> aggregator;
+            dispatcher* worker;
+        };
+
+        // The framesets queues of the devices, outliving stop() for the callers still waiting on them
+        struct frameset_queues
+        {
+            std::vector<std::shared_ptr<single_consumer_queue<frame_holder>>> queues;
+            std::mutex mutex;
+            std::condition_variable cv;
+            uint64_t generation = 0;    // Bumped on every frameset, so that a waiter does not miss one
+            size_t next = 0;            // Queue served first by the next dequeue
+            bool stopped = false;
+
+            void notify();
+            bool try_dequeue(frame_holder* frame);
+            bool dequeue(frame_holder* frame, unsigned int timeout_ms);
+        };
+
+        void unsafe_stop();
+
+        std::shared_ptr<librealsense::context> _ctx;
+        mutable std::mutex _mtx;
+        std::vector<std::unique_ptr<device_session>> _sessions;
+        std::vector<std::unique_ptr<dispatcher>> _workers;
+        std::shared_ptr<frameset_queues> _framesets;
+    };
 }
@@ -121,6 +121,9 @@ namespace librealsense
         
         auto of = dynamic_cast<frame*>(original);
         frame_additional_data data = of->additional_data;
+        // The new frame lives in a buffer of the frame pool, not in the kernel buffer of the original
+        data.dmabuf_fd = -1;
+        data.dmabuf_offset = 0;
         auto res = _actual_source.alloc_frame(frame_type, stride * height, data, true);
         if (!res) throw wrong_api_call_sequence_exception("Out of frame resources!");
         vf = static_cast<video_frame*>(res);
@@ -87,6 +87,11 @@ struct rs2_pipeline
     std::shared_ptr<librealsense::pipeline> pipe;
 };
 
+struct rs2_multi_pipeline
+{
+    std::shared_ptr<librealsense::multi_pipeline> pipe;
+};
+
 struct rs2_config
 {
     std::shared_ptr<librealsense::pipeline_config> config;
@@ -361,6 +366,19 @@ rs2_stream_profile_list* rs2_get_stream_profiles(rs2_sensor* sensor, rs2_error**
 }
 HANDLE_EXCEPTIONS_AND_RETURN(nullptr, sensor)
 
+void rs2_get_stream_statistics(const rs2_sensor* sensor, rs2_stream stream, int index, rs2_stream_statistics* statistics, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(sensor);
+    VALIDATE_ENUM(stream);
+    VALIDATE_NOT_NULL(statistics);
+
+    auto base = dynamic_cast<librealsense::sensor_base*>(sensor->sensor);
+    if (!base)
+        throw librealsense::not_implemented_exception("Stream statistics are not available for this sensor");
+    *statistics = base->get_stream_statistics(stream, index)->get();
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, sensor, stream, index, statistics)
+
 const rs2_stream_profile* rs2_get_stream_profile(const rs2_stream_profile_list* list, int index, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(list);
@@ -947,7 +965,9 @@ void rs2_enqueue_frame(rs2_frame* frame, void* queue) BEGIN_API_CALL
     auto q = reinterpret_cast<rs2_frame_queue*>(queue);
     librealsense::frame_holder fh;
     fh.frame = (frame_interface*)frame;
-    q->queue.enqueue(std::move(fh));
+    librealsense::frame_holder dropped;
+    if (q->queue.enqueue(std::move(fh), &dropped))
+        librealsense::record_queue_overflow(dropped.frame);
 }
 NOEXCEPT_RETURN(, frame, queue)
 
@@ -1081,6 +1101,8 @@ const char* rs2_sr300_visual_preset_to_string(rs2_sr300_visual_preset preset)
 const char* rs2_log_severity_to_string(rs2_log_severity severity)                         { return librealsense::get_string(severity);     }
 const char* rs2_exception_type_to_string(rs2_exception_type type)                         { return librealsense::get_string(type);         }
 const char* rs2_playback_status_to_string(rs2_playback_status status)                     { return librealsense::get_string(status);       }
+const char* rs2_record_compression_to_string(rs2_record_compression compression)          { return librealsense::get_string(compression);  }
+const char* rs2_record_overflow_policy_to_string(rs2_record_overflow_policy policy)        { return librealsense::get_string(policy);  }
 const char* rs2_extension_type_to_string(rs2_extension type)                              { return librealsense::get_string(type);         }
 const char* rs2_frame_metadata_to_string(rs2_frame_metadata_value metadata)               { return librealsense::get_string(metadata);     }
 const char* rs2_extension_to_string(rs2_extension type)                                   { return rs2_extension_type_to_string(type);     }
@@ -1156,6 +1178,11 @@ int rs2_is_frame_extendable_to(const rs2_frame* f, rs2_extension extension_type,
     case RS2_EXTENSION_DISPARITY_FRAME : return VALIDATE_INTERFACE_NO_THROW((frame_interface*)f, librealsense::disparity_frame) != nullptr;
     case RS2_EXTENSION_MOTION_FRAME    : return VALIDATE_INTERFACE_NO_THROW((frame_interface*)f, librealsense::motion_frame)    != nullptr;
     case RS2_EXTENSION_POSE_FRAME      : return VALIDATE_INTERFACE_NO_THROW((frame_interface*)f, librealsense::pose_frame)      != nullptr;
+    case RS2_EXTENSION_DMABUF_FRAME    :
+    {
+        auto vf = VALIDATE_INTERFACE_NO_THROW((frame_interface*)f, librealsense::video_frame);
+        return vf && vf->get_dmabuf_fd() >= 0;
+    }
 
     default:
         return false;
@@ -1260,6 +1287,63 @@ int rs2_playback_device_is_real_time(const rs2_device* device, rs2_error** error
 }
 HANDLE_EXCEPTIONS_AND_RETURN(0, device)
 
+void rs2_playback_device_set_read_ahead(const rs2_device* device, unsigned int max_frames, unsigned long long max_bytes, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    auto playback = VALIDATE_INTERFACE(device->device, librealsense::playback_device);
+    playback->set_read_ahead(max_frames, static_cast<size_t>(max_bytes));
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, device, max_frames, max_bytes)
+
+unsigned long long rs2_playback_get_frame_count(const rs2_device* device, const rs2_stream_profile* profile, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    VALIDATE_NOT_NULL(profile);
+    auto playback = VALIDATE_INTERFACE(device->device, librealsense::playback_device);
+    return playback->get_frame_count(*profile->profile);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, device, profile)
+
+rs2_frame* rs2_playback_get_frame(const rs2_device* device, const rs2_stream_profile* profile, unsigned long long position, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    VALIDATE_NOT_NULL(profile);
+    auto playback = VALIDATE_INTERFACE(device->device, librealsense::playback_device);
+    auto fh = playback->get_frame(*profile->profile, position);
+    frame_interface* result = nullptr;
+    std::swap(result, fh.frame);
+    return (rs2_frame*)result;
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, device, profile, position)
+
+long long int rs2_playback_get_frame_time(const rs2_device* device, const rs2_stream_profile* profile, unsigned long long position, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    VALIDATE_NOT_NULL(profile);
+    auto playback = VALIDATE_INTERFACE(device->device, librealsense::playback_device);
+    return playback->get_frame_time(*profile->profile, position).count();
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, device, profile, position)
+
+unsigned long long rs2_playback_find_frame(const rs2_device* device, const rs2_stream_profile* profile, long long int time, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    VALIDATE_NOT_NULL(profile);
+    VALIDATE_LE(0, time);
+    auto playback = VALIDATE_INTERFACE(device->device, librealsense::playback_device);
+    return playback->find_frame(*profile->profile, std::chrono::nanoseconds(time));
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, device, profile, time)
+
+unsigned long long rs2_playback_find_frame_number(const rs2_device* device, const rs2_stream_profile* profile, unsigned long long frame_number, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    VALIDATE_NOT_NULL(profile);
+    auto playback = VALIDATE_INTERFACE(device->device, librealsense::playback_device);
+    return playback->find_frame_number(*profile->profile, frame_number);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, device, profile, frame_number)
+
 void rs2_playback_device_set_status_changed_callback(const rs2_device* device, rs2_playback_status_changed_callback* callback, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(device);
@@ -1308,6 +1392,20 @@ rs2_device* rs2_create_record_device(const rs2_device* device, const char* file,
 }
 HANDLE_EXCEPTIONS_AND_RETURN(nullptr, device, file)
 
+rs2_device* rs2_create_record_device_ex(const rs2_device* device, const char* file, rs2_record_compression compression, unsigned int chunk_size, unsigned int compression_threads, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    VALIDATE_NOT_NULL(file);
+    VALIDATE_ENUM(compression);
+
+    return new rs2_device({
+        device->ctx,
+        device->info,
+        std::make_shared<record_device>(device->device, std::make_shared<ros_writer>(file, compression, chunk_size, compression_threads))
+    });
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, device, file, compression, chunk_size, compression_threads)
+
 void rs2_record_device_pause(const rs2_device* device, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(device);
@@ -1324,6 +1422,15 @@ void rs2_record_device_resume(const rs2_device* device, rs2_error** error) BEGIN
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, device)
 
+void rs2_record_device_set_rotation(const rs2_device* device, unsigned long long max_bytes, long long int max_duration, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    VALIDATE_LE(0, max_duration);
+    auto record_device = VALIDATE_INTERFACE(device->device, librealsense::record_device);
+    record_device->set_rotation(max_bytes, std::chrono::nanoseconds(max_duration));
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, device, max_bytes, max_duration)
+
 const char* rs2_record_device_filename(const rs2_device* device, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(device);
@@ -1332,6 +1439,32 @@ const char* rs2_record_device_filename(const rs2_device* device, rs2_error** err
 }
 HANDLE_EXCEPTIONS_AND_RETURN(nullptr, device)
 
+void rs2_record_device_set_write_buffer(const rs2_device* device, unsigned long long max_bytes, rs2_record_overflow_policy policy, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    VALIDATE_ENUM(policy);
+    auto record_device = VALIDATE_INTERFACE(device->device, librealsense::record_device);
+    record_device->set_write_buffer(max_bytes, policy);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, device, max_bytes, policy)
+
+unsigned long long rs2_record_device_get_dropped_frames(const rs2_device* device, const rs2_stream_profile* profile, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    VALIDATE_NOT_NULL(profile);
+    auto record_device = VALIDATE_INTERFACE(device->device, librealsense::record_device);
+    return record_device->get_dropped_frames(*profile->profile);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, device, profile)
+
+unsigned long long rs2_record_device_get_buffered_bytes(const rs2_device* device, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    auto record_device = VALIDATE_INTERFACE(device->device, librealsense::record_device);
+    return record_device->get_buffered_bytes();
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, device)
+
 
 rs2_frame* rs2_allocate_synthetic_video_frame(rs2_source* source, const rs2_stream_profile* new_stream, rs2_frame* original,
     int new_bpp, int new_width, int new_height, int new_stride, rs2_extension frame_type, rs2_error** error) BEGIN_API_CALL
@@ -1550,6 +1683,32 @@ void rs2_config_enable_record_to_file(rs2_config* config, const char* file, rs2_
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, config, file)
 
+void rs2_config_enable_record_to_file_ex(rs2_config* config, const char* file, rs2_record_compression compression, unsigned int chunk_size, unsigned int compression_threads, rs2_error ** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(config);
+    VALIDATE_NOT_NULL(file);
+    VALIDATE_ENUM(compression);
+
+    config->config->enable_record_to_file(file, compression, chunk_size, compression_threads);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, config, file, compression, chunk_size, compression_threads)
+
+void rs2_config_enable_profile_cache(rs2_config* config, const char* file, rs2_error ** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(config);
+    VALIDATE_NOT_NULL(file);
+
+    config->config->enable_profile_cache(file);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, config, file)
+
+void rs2_config_enable_bandwidth_aware_resolve(rs2_config* config, int enable, rs2_error ** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(config);
+    config->config->enable_bandwidth_aware_resolve(enable != 0);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, config, enable)
+
 void rs2_config_disable_stream(rs2_config* config, rs2_stream stream, rs2_error ** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(config);
@@ -1587,6 +1746,85 @@ int rs2_config_can_resolve(rs2_config* config, rs2_pipeline* pipe, rs2_error **
 }
 HANDLE_EXCEPTIONS_AND_RETURN(0, config, pipe)
 
+rs2_multi_pipeline* rs2_create_multi_pipeline(rs2_context* ctx, rs2_error ** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(ctx);
+
+    return new rs2_multi_pipeline{ std::make_shared<librealsense::multi_pipeline>(ctx->ctx) };
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, ctx)
+
+void rs2_multi_pipeline_start_with_config(rs2_multi_pipeline* pipe, rs2_config* config, rs2_error ** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(pipe);
+    VALIDATE_NOT_NULL(config);
+
+    pipe->pipe->start(config->config);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, pipe, config)
+
+void rs2_multi_pipeline_stop(rs2_multi_pipeline* pipe, rs2_error ** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(pipe);
+
+    pipe->pipe->stop();
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, pipe)
+
+rs2_frame* rs2_multi_pipeline_wait_for_frames(rs2_multi_pipeline* pipe, unsigned int timeout_ms, rs2_error ** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(pipe);
+
+    auto f = pipe->pipe->wait_for_frames(timeout_ms);
+    auto frame = f.frame;
+    f.frame = nullptr;
+    return (rs2_frame*)(frame);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, pipe)
+
+int rs2_multi_pipeline_poll_for_frames(rs2_multi_pipeline* pipe, rs2_frame** output_frame, rs2_error ** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(pipe);
+    VALIDATE_NOT_NULL(output_frame);
+
+    librealsense::frame_holder fh;
+    if (pipe->pipe->poll_for_frames(&fh))
+    {
+        frame_interface* result = nullptr;
+        std::swap(result, fh.frame);
+        *output_frame = (rs2_frame*)result;
+        return true;
+    }
+    return false;
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, pipe, output_frame)
+
+int rs2_multi_pipeline_get_profiles_count(rs2_multi_pipeline* pipe, rs2_error ** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(pipe);
+
+    return static_cast<int>(pipe->pipe->get_active_profiles().size());
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, pipe)
+
+rs2_pipeline_profile* rs2_multi_pipeline_get_active_profile(rs2_multi_pipeline* pipe, int index, rs2_error ** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(pipe);
+
+    auto profiles = pipe->pipe->get_active_profiles();
+    VALIDATE_RANGE(index, 0, (int)profiles.size() - 1);
+    return new rs2_pipeline_profile{ profiles[index] };
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, pipe, index)
+
+void rs2_delete_multi_pipeline(rs2_multi_pipeline* pipe) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(pipe);
+
+    delete pipe;
+}
+NOEXCEPT_RETURN(, pipe)
+
 rs2_processing_block* rs2_create_processing_block(rs2_frame_processor_callback* proc, rs2_error** error) BEGIN_API_CALL
 {
     auto block = std::make_shared<librealsense::processing_block>();
@@ -1874,6 +2112,52 @@ void rs2_pose_frame_get_pose_data(const rs2_frame* frame, rs2_pose* pose, rs2_er
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, frame, pose)
 
+int rs2_motion_frame_get_samples_count(const rs2_frame* frame, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(frame);
+    auto mf = VALIDATE_INTERFACE((frame_interface*)frame, librealsense::motion_frame);
+    return static_cast<int>(mf->get_samples_count());
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, frame)
+
+const void* rs2_motion_frame_get_sample_data(const rs2_frame* frame, int index, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(frame);
+    VALIDATE_RANGE(index, 0, std::numeric_limits<int>::max());
+    auto mf = VALIDATE_INTERFACE((frame_interface*)frame, librealsense::motion_frame);
+    return mf->get_sample_data(static_cast<uint32_t>(index));
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, frame, index)
+
+rs2_time_t rs2_motion_frame_get_sample_timestamp(const rs2_frame* frame, int index, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(frame);
+    VALIDATE_RANGE(index, 0, std::numeric_limits<int>::max());
+    auto mf = VALIDATE_INTERFACE((frame_interface*)frame, librealsense::motion_frame);
+    return mf->get_sample_timestamp(static_cast<uint32_t>(index));
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, frame, index)
+
+int rs2_get_frame_dmabuf_fd(const rs2_frame* frame_ref, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(frame_ref);
+    auto vf = VALIDATE_INTERFACE(((frame_interface*)frame_ref), librealsense::video_frame);
+    if (vf->get_dmabuf_fd() < 0)
+        throw invalid_value_exception("frame data is not held in an exported DMABUF");
+    return vf->get_dmabuf_fd();
+}
+HANDLE_EXCEPTIONS_AND_RETURN(-1, frame_ref)
+
+int rs2_get_frame_dmabuf_offset(const rs2_frame* frame_ref, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(frame_ref);
+    auto vf = VALIDATE_INTERFACE(((frame_interface*)frame_ref), librealsense::video_frame);
+    if (vf->get_dmabuf_fd() < 0)
+        throw invalid_value_exception("frame data is not held in an exported DMABUF");
+    return static_cast<int>(vf->get_dmabuf_offset());
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, frame_ref)
+
 rs2_time_t rs2_get_time(rs2_error** error) BEGIN_API_CALL
 {
     return environment::get_instance().get_time_service()->get_time();
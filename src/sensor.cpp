@@ -11,6 +11,7 @@
 #include "device.h"
 #include "stream.h"
 #include "sensor.h"
+#include "option.h"
 
 namespace librealsense
 {
@@ -90,6 +91,47 @@ namespace librealsense
     {
         return _source.set_callback(callback);
     }
+    std::shared_ptr<stream_statistics> sensor_base::get_stream_statistics(rs2_stream stream, int index)
+    {
+        std::lock_guard<std::mutex> lock(_statistics_mutex);
+        auto&& statistics = _statistics[std::make_pair(stream, index)];
+        if (!statistics)
+            statistics = std::make_shared<stream_statistics>();
+        return statistics;
+    }
+
+    void sensor_base::reset_stream_statistics()
+    {
+        std::lock_guard<std::mutex> lock(_statistics_mutex);
+        for (auto&& kvp : _statistics)
+            kvp.second->reset();
+    }
+
+    void sensor_base::invoke_callback(frame_holder frame, stream_statistics& statistics)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+        _source.invoke_callback(std::move(frame));
+        statistics.callback_duration.add(std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count());
+    }
+
+    void record_queue_overflow(frame_interface* dropped)
+    {
+        if (!dropped)
+            return;
+
+        if (auto composite = dynamic_cast<composite_frame*>(dropped))
+        {
+            for (size_t i = 0; i < composite->get_embedded_frames_count(); ++i)
+                record_queue_overflow(composite->get_frame(static_cast<int>(i)));
+            return;
+        }
+
+        auto sensor = std::dynamic_pointer_cast<sensor_base>(dropped->get_sensor());
+        auto stream = dropped->get_stream();
+        if (sensor && stream)
+            sensor->get_stream_statistics(stream->get_stream_type(), stream->get_stream_index())->queue_overflows++;
+    }
+
     std::shared_ptr<notifications_processor> sensor_base::get_notifications_processor()
     {
         return _notifications_processor;
@@ -405,6 +447,11 @@ namespace librealsense
         auto mapping = resolve_requests(requests);
 
         auto timestamp_reader = _timestamp_reader.get();
+        auto last_stream = _device->get_capture_statistics();
+        auto export_dmabuf = _export_dmabuf;
+        if (_device->supports_dmabuf_export())
+            _device->set_dmabuf_export(export_dmabuf);
+        reset_stream_statistics();
 
         std::vector<platform::stream_profile> commited;
 
@@ -414,10 +461,25 @@ namespace librealsense
             {
                 unsigned long long last_frame_number = 0;
                 rs2_time_t last_timestamp = 0;
+                std::vector<std::shared_ptr<stream_statistics>> statistics;
+                for (auto&& output : mode.unpacker->outputs)
+                    statistics.push_back(get_stream_statistics(output.stream_desc.type, output.stream_desc.index));
+
                 _device->probe_and_commit(mode.profile,
-                [this, mode, timestamp_reader, requests, last_frame_number, last_timestamp](platform::stream_profile p, platform::frame_object f, std::function<void()> continuation) mutable
+                [this, mode, timestamp_reader, requests, last_frame_number, last_timestamp, export_dmabuf,
+                 statistics](platform::stream_profile p, platform::frame_object f, std::function<void()> continuation) mutable
                 {
                     auto system_time = environment::get_instance().get_time_service()->get_time();
+
+                    // Frames lost before reaching the host, as counted by the capture monitor of backends that report them
+                    for (auto&& stats : statistics)
+                    {
+                        stats->frames_received++;
+                        stats->kernel_drops += f.dropped_frames;
+                        if (f.dequeue_time)
+                            stats->kernel_to_dequeue.add(f.dequeue_time - f.backend_time);
+                    }
+
                     if (!this->is_streaming())
                     {
                         LOG_WARNING("Frame received with streaming inactive,"
@@ -439,10 +501,12 @@ namespace librealsense
 
                     std::vector<byte *> dest;
                     std::vector<frame_holder> refs;
+                    std::vector<stream_statistics*> refs_statistics;
 
                     auto&& unpacker = *mode.unpacker;
-                    for (auto&& output : unpacker.outputs)
+                    for (size_t i = 0; i < unpacker.outputs.size(); ++i)
                     {
+                        auto&& output = unpacker.outputs[i];
                         LOG_DEBUG("FrameAccepted," << librealsense::get_string(output.stream_desc.type) << "," << std::dec << frame_counter
                             << output.stream_desc.index << "," << frame_counter
                             << ",Arrived," << std::fixed << f.backend_time << " " << std::fixed << system_time<<" diff - "<< system_time- f.backend_time << " "
@@ -470,6 +534,15 @@ namespace librealsense
                             last_timestamp,
                             last_frame_number);
 
+                        // Only unprocessed frames keep the kernel buffer as their data
+                        if (export_dmabuf && !requires_processing)
+                            additional_data.dmabuf_fd = f.dmabuf_fd;
+                        if (f.dequeue_time)
+                        {
+                            additional_data.kernel_sequence = f.sequence;
+                            additional_data.dequeue_time = f.dequeue_time;
+                        }
+
                         last_frame_number = frame_counter;
                         last_timestamp = timestamp;
 
@@ -486,10 +559,12 @@ namespace librealsense
                             dest.push_back(const_cast<byte*>(video->get_frame_data()));
                             frame->set_stream(request);
                             refs.push_back(std::move(frame));
+                            refs_statistics.push_back(statistics[i].get());
                         }
                         else
                         {
                             LOG_INFO("Dropped frame. alloc_frame(...) returned nullptr");
+                            statistics[i]->publish_failures++;
                             return;
                         }
 
@@ -504,8 +579,9 @@ namespace librealsense
                     }
 
                     // If any frame callbacks were specified, dispatch them now
-                    for (auto&& pref : refs)
+                    for (size_t i = 0; i < refs.size(); ++i)
                     {
+                        auto&& pref = refs[i];
                         if (!requires_processing)
                         {
                             pref->attach_continuation(std::move(release_and_enqueue));
@@ -519,9 +595,14 @@ namespace librealsense
                         }
 
                         if (pref->get_stream().get())
-                            _source.invoke_callback(std::move(pref));
+                        {
+                            if (f.dequeue_time)
+                                refs_statistics[i]->dequeue_to_callback.add(
+                                    environment::get_instance().get_time_service()->get_time() - f.dequeue_time);
+                            invoke_callback(std::move(pref), *refs_statistics[i]);
+                        }
                     }
-                });
+                }, get_frame_buffers(mode.profile.fps, last_stream));
             }
             catch(...)
             {
@@ -545,6 +626,7 @@ namespace librealsense
         try {
             _device->stream_on([&](const notification& n)
             {
+                invalidate_option_cache();
                 _notifications_processor->raise_notification(n);
             });
         }
@@ -757,6 +839,11 @@ namespace librealsense
             _hid_sensors.push_back(elem);
 
         _hid_device->close();
+
+        auto batching_option = std::make_shared<ptr_option<bool>>(false, true, true, false, &_batch_motion_samples_option,
+            "Deliver the motion samples of a single read as one batched motion frame");
+        batching_option->on_set([this](float value) { _batch_motion_samples = (value != 0); });
+        register_option(RS2_OPTION_MOTION_SAMPLES_BATCHING, batching_option);
     }
 
     hid_sensor::~hid_sensor()
@@ -804,6 +891,7 @@ namespace librealsense
         else if (_is_opened)
             throw wrong_api_call_sequence_exception("Hid device is already opened!");
 
+        reset_stream_statistics();
         auto mapping = resolve_requests(requests);
         for (auto& request : requests)
         {
@@ -831,6 +919,13 @@ namespace librealsense
             }
         }
 
+        // The statistics of the streams are looked up once, instead of for every sample
+        for (auto&& kvp : _hid_mapping)
+        {
+            auto request = *(kvp.second.original_requests.begin());
+            _hid_statistics[kvp.first] = get_stream_statistics(request->get_stream_type(), request->get_stream_index());
+        }
+
         std::vector<platform::hid_profile> configured_hid_profiles;
         for (auto& elem : _configured_profiles)
         {
@@ -854,6 +949,7 @@ namespace librealsense
         _is_configured_stream.clear();
         _is_configured_stream.resize(RS2_STREAM_COUNT);
         _hid_mapping.clear();
+        _hid_statistics.clear();
         _is_opened = false;
         set_active_streams({});
     }
@@ -883,84 +979,182 @@ namespace librealsense
         _source.init(_metadata_parsers);
         _source.set_sensor(this->shared_from_this());
         raise_on_before_streaming_changes(true); //Required to be just before actual start allow recording to work
-        _hid_device->start_capture([this](const platform::sensor_data& sensor_data)
+        _hid_device->start_batch_capture([this](const std::vector<platform::sensor_data>& samples)
         {
-            auto system_time = environment::get_instance().get_time_service()->get_time();
-            auto timestamp_reader = _hid_iio_timestamp_reader.get();
-
-            // TODO:
-            static const std::string custom_sensor_name = "custom";
-            auto sensor_name = sensor_data.sensor.name;
-            bool is_custom_sensor = false;
-            static const uint32_t custom_source_id_offset = 16;
-            uint8_t custom_gpio = 0;
-            auto custom_stream_type = RS2_STREAM_ANY;
-            if (sensor_name == custom_sensor_name)
-            {
-                custom_gpio = *(reinterpret_cast<uint8_t*>((uint8_t*)(sensor_data.fo.pixels) + custom_source_id_offset));
-                custom_stream_type = custom_gpio_to_stream_type(custom_gpio);
+            if (_batch_motion_samples && samples.size() > 1)
+                publish_batch(samples);
+            else
+                for (auto&& sample : samples)
+                    publish_sample(sample);
+        });
 
-                if (!_is_configured_stream[custom_stream_type])
-                {
-                    LOG_DEBUG("Unrequested " << rs2_stream_to_string(custom_stream_type) << " frame was dropped.");
-                    return;
-                }
+        _is_streaming = true;
+    }
 
-                is_custom_sensor = true;
-                timestamp_reader = _custom_hid_timestamp_reader.get();
-            }
+    void hid_sensor::publish_sample(const platform::sensor_data& sensor_data)
+    {
+        auto system_time = environment::get_instance().get_time_service()->get_time();
+        auto timestamp_reader = _hid_iio_timestamp_reader.get();
+
+        // TODO:
+        static const std::string custom_sensor_name = "custom";
+        auto sensor_name = sensor_data.sensor.name;
+        bool is_custom_sensor = false;
+        static const uint32_t custom_source_id_offset = 16;
+        uint8_t custom_gpio = 0;
+        auto custom_stream_type = RS2_STREAM_ANY;
+        if (sensor_name == custom_sensor_name)
+        {
+            custom_gpio = *(reinterpret_cast<uint8_t*>((uint8_t*)(sensor_data.fo.pixels) + custom_source_id_offset));
+            custom_stream_type = custom_gpio_to_stream_type(custom_gpio);
 
-            if (!this->is_streaming())
+            if (!_is_configured_stream[custom_stream_type])
             {
-                LOG_INFO("HID Frame received when Streaming is not active,"
-                            << get_string(_configured_profiles[sensor_name].stream)
-                            << ",Arrived," << std::fixed << system_time);
+                LOG_DEBUG("Unrequested " << rs2_stream_to_string(custom_stream_type) << " frame was dropped.");
                 return;
             }
 
-            auto mode = _hid_mapping[sensor_name];
-            auto request = *(mode.original_requests.begin());
-            auto data_size = sensor_data.fo.frame_size;
-            mode.profile.width = (uint32_t)data_size;
-            mode.profile.height = 1;
-
-            // Determine the timestamp for this HID frame
-            auto timestamp = timestamp_reader->get_frame_timestamp(mode, sensor_data.fo);
-            auto frame_counter = timestamp_reader->get_frame_counter(mode, sensor_data.fo);
-
-            frame_additional_data additional_data{};
-
-            additional_data.timestamp = timestamp;
-            additional_data.frame_number = frame_counter;
-            additional_data.timestamp_domain = timestamp_reader->get_frame_timestamp_domain(mode, sensor_data.fo);
-            additional_data.system_time = system_time;
-            LOG_DEBUG("FrameAccepted," << get_string(request->get_stream_type()) << "," << std::dec << frame_counter
-                      << ",Arrived," << std::fixed << system_time
-                      << ",TS," << std::fixed << timestamp
-                      << ",TS_Domain," << rs2_timestamp_domain_to_string(additional_data.timestamp_domain));
-
-            auto frame = _source.alloc_frame(RS2_EXTENSION_MOTION_FRAME, data_size, additional_data, true);
-            if (!frame)
-            {
-                LOG_INFO("Dropped frame. alloc_frame(...) returned nullptr");
-                return;
-            }
-            frame->set_stream(request);
+            is_custom_sensor = true;
+            timestamp_reader = _custom_hid_timestamp_reader.get();
+        }
 
-            std::vector<byte*> dest{const_cast<byte*>(frame->get_frame_data())};
-            mode.unpacker->unpack(dest.data(),(const byte*)sensor_data.fo.pixels, mode.profile.width, mode.profile.height);
+        if (!this->is_streaming())
+        {
+            LOG_INFO("HID Frame received when Streaming is not active,"
+                        << get_string(_configured_profiles[sensor_name].stream)
+                        << ",Arrived," << std::fixed << system_time);
+            return;
+        }
 
-            if (_on_before_frame_callback)
-            {
-                auto callback = _source.begin_callback();
-                auto stream_type = frame->get_stream()->get_stream_type();
-                _on_before_frame_callback(stream_type, frame, std::move(callback));
-            }
+        auto mode = _hid_mapping[sensor_name];
+        auto request = *(mode.original_requests.begin());
+        auto data_size = sensor_data.fo.frame_size;
+        mode.profile.width = (uint32_t)data_size;
+        mode.profile.height = 1;
 
-            _source.invoke_callback(std::move(frame));
-        });
+        // Determine the timestamp for this HID frame
+        auto timestamp = timestamp_reader->get_frame_timestamp(mode, sensor_data.fo);
+        auto frame_counter = timestamp_reader->get_frame_counter(mode, sensor_data.fo);
 
-        _is_streaming = true;
+        frame_additional_data additional_data{};
+
+        additional_data.timestamp = timestamp;
+        additional_data.frame_number = frame_counter;
+        additional_data.timestamp_domain = timestamp_reader->get_frame_timestamp_domain(mode, sensor_data.fo);
+        additional_data.system_time = system_time;
+        LOG_DEBUG("FrameAccepted," << get_string(request->get_stream_type()) << "," << std::dec << frame_counter
+                  << ",Arrived," << std::fixed << system_time
+                  << ",TS," << std::fixed << timestamp
+                  << ",TS_Domain," << rs2_timestamp_domain_to_string(additional_data.timestamp_domain));
+
+        auto&& statistics = *_hid_statistics.at(sensor_name);
+        statistics.frames_received++;
+
+        auto frame = _source.alloc_frame(RS2_EXTENSION_MOTION_FRAME, data_size, additional_data, true);
+        if (!frame)
+        {
+            LOG_INFO("Dropped frame. alloc_frame(...) returned nullptr");
+            statistics.publish_failures++;
+            return;
+        }
+        frame->set_stream(request);
+
+        std::vector<byte*> dest{const_cast<byte*>(frame->get_frame_data())};
+        mode.unpacker->unpack(dest.data(),(const byte*)sensor_data.fo.pixels, mode.profile.width, mode.profile.height);
+
+        if (_on_before_frame_callback)
+        {
+            auto callback = _source.begin_callback();
+            auto stream_type = frame->get_stream()->get_stream_type();
+            _on_before_frame_callback(stream_type, frame, std::move(callback));
+        }
+
+        invoke_callback(std::move(frame), statistics);
+    }
+
+    void hid_sensor::publish_batch(const std::vector<platform::sensor_data>& samples)
+    {
+        auto system_time = environment::get_instance().get_time_service()->get_time();
+        auto timestamp_reader = _hid_iio_timestamp_reader.get();
+        auto sensor_name = samples.front().sensor.name;
+
+        // Samples of the custom sensor may belong to different GPIO streams
+        static const std::string custom_sensor_name = "custom";
+        if (sensor_name == custom_sensor_name)
+        {
+            for (auto&& sample : samples)
+                publish_sample(sample);
+            return;
+        }
+
+        if (!this->is_streaming())
+        {
+            LOG_INFO("HID Frame received when Streaming is not active,"
+                        << get_string(_configured_profiles[sensor_name].stream)
+                        << ",Arrived," << std::fixed << system_time);
+            return;
+        }
+
+        auto mode = _hid_mapping[sensor_name];
+        auto request = *(mode.original_requests.begin());
+        auto data_size = samples.front().fo.frame_size;
+        mode.profile.width = (uint32_t)data_size;
+        mode.profile.height = 1;
+
+        // Every sample is timestamped and numbered, the first one also stamps the frame
+        std::vector<rs2_time_t> timestamps;
+        std::vector<unsigned long long> frame_counters;
+        for (auto&& sample : samples)
+        {
+            timestamps.push_back(timestamp_reader->get_frame_timestamp(mode, sample.fo));
+            frame_counters.push_back(timestamp_reader->get_frame_counter(mode, sample.fo));
+        }
+        auto frame_counter = frame_counters.front();
+
+        frame_additional_data additional_data{};
+
+        additional_data.timestamp = timestamps.front();
+        additional_data.frame_number = frame_counter;
+        additional_data.timestamp_domain = timestamp_reader->get_frame_timestamp_domain(mode, samples.front().fo);
+        additional_data.system_time = system_time;
+        additional_data.motion_samples_count = static_cast<uint32_t>(samples.size());
+        LOG_DEBUG("FrameAccepted," << get_string(request->get_stream_type()) << "," << std::dec << frame_counter
+                  << ",Arrived," << std::fixed << system_time
+                  << ",TS," << std::fixed << timestamps.front()
+                  << ",Samples," << samples.size()
+                  << ",TS_Domain," << rs2_timestamp_domain_to_string(additional_data.timestamp_domain));
+
+        auto&& statistics = *_hid_statistics.at(sensor_name);
+        statistics.frames_received++;
+
+        auto frame = _source.alloc_frame(RS2_EXTENSION_MOTION_FRAME, motion_frame::get_batch_size(additional_data.motion_samples_count, data_size),
+                                         additional_data, true);
+        if (!frame)
+        {
+            LOG_INFO("Dropped frame. alloc_frame(...) returned nullptr");
+            statistics.publish_failures++;
+            return;
+        }
+        frame->set_stream(request);
+
+        auto samples_data = const_cast<byte*>(frame->get_frame_data());
+        for (size_t i = 0; i < samples.size(); ++i)
+        {
+            std::vector<byte*> dest{ samples_data + i * data_size };
+            mode.unpacker->unpack(dest.data(), (const byte*)samples[i].fo.pixels, mode.profile.width, mode.profile.height);
+        }
+        auto timestamps_data = samples_data + samples.size() * data_size;
+        librealsense::copy(timestamps_data, timestamps.data(), timestamps.size() * sizeof(rs2_time_t));
+        librealsense::copy(timestamps_data + timestamps.size() * sizeof(rs2_time_t), frame_counters.data(), frame_counters.size() * sizeof(unsigned long long));
+
+        if (_on_before_frame_callback)
+        {
+            auto callback = _source.begin_callback();
+            auto stream_type = frame->get_stream()->get_stream_type();
+            _on_before_frame_callback(stream_type, frame, std::move(callback));
+        }
+
+        invoke_callback(std::move(frame), statistics);
     }
 
     void hid_sensor::stop()
@@ -1039,8 +1233,54 @@ namespace librealsense
         : sensor_base(name, dev),
           _device(move(uvc_device)),
           _user_count(0),
-          _timestamp_reader(std::move(timestamp_reader))
+          _timestamp_reader(std::move(timestamp_reader)),
+          _option_cache_generation(1)
     {
         register_metadata(RS2_FRAME_METADATA_BACKEND_TIMESTAMP,     make_additional_data_parser(&frame_additional_data::backend_timestamp));
+        register_metadata(RS2_FRAME_METADATA_KERNEL_FRAME_SEQUENCE, make_dequeued_buffer_parser(&frame_additional_data::kernel_sequence));
+        register_metadata(RS2_FRAME_METADATA_DEQUEUE_TIMESTAMP,     make_dequeued_buffer_parser(&frame_additional_data::dequeue_time));
+
+        register_option(RS2_OPTION_ADAPTIVE_FRAME_BUFFERS,
+            std::make_shared<ptr_option<bool>>(false, true, true, false, &_adaptive_frame_buffers,
+                "Choose the number of kernel frame buffers on stream start from the previous stream of the sensor"));
+
+        auto device = _device;
+        register_option(RS2_OPTION_FRAME_BUFFERS,
+            std::make_shared<readonly_callback_option>("Number of kernel frame buffers the stream was started with",
+                [device]() { return static_cast<float>(device->get_capture_statistics().buffers); },
+                option_range{ 0, MAX_V4L2_FRAME_BUFFERS, 1, DEFAULT_V4L2_FRAME_BUFFERS }));
+        register_option(RS2_OPTION_DROPPED_FRAMES,
+            std::make_shared<readonly_callback_option>("Number of frames dropped by the kernel since the stream was started",
+                [device]() { return static_cast<float>(device->get_capture_statistics().dropped_frames); },
+                option_range{ 0, std::numeric_limits<float>::max(), 1, 0 }));
+
+        if (_device->supports_dmabuf_export())
+        {
+            register_option(RS2_OPTION_DMABUF_EXPORT,
+                std::make_shared<ptr_option<bool>>(false, true, true, false, &_export_dmabuf,
+                    "Export the frame buffers of the next stream as DMABUF file descriptors, frame metadata is not available while exporting"));
+        }
+    }
+
+    int uvc_sensor::get_frame_buffers(uint32_t fps, const platform::capture_statistics& last_stream) const
+    {
+        if (!_adaptive_frame_buffers || !last_stream.frames || !fps)
+            return DEFAULT_V4L2_FRAME_BUFFERS;
+
+        // Enough buffers to cover the longest time the application held one, plus one being filled by the
+        // kernel and one queued behind it
+        auto frame_time_ms = 1000. / fps;
+        auto buffers = static_cast<int>(std::ceil(last_stream.max_hold_time_ms / frame_time_ms)) + 2;
+
+        // Frames were dropped although the hold times did not call for more buffers; the previous
+        // stream still stalled on the application, so grow by one
+        if (last_stream.dropped_frames && buffers <= static_cast<int>(last_stream.buffers) &&
+            last_stream.max_hold_time_ms > frame_time_ms)
+            buffers = last_stream.buffers + 1;
+
+        buffers = std::max<int>(MIN_V4L2_FRAME_BUFFERS, std::min<int>(MAX_V4L2_FRAME_BUFFERS, buffers));
+        LOG_INFO("Adaptive frame buffers: " << buffers << " buffers at " << fps << " fps, last stream held a buffer up to "
+            << last_stream.max_hold_time_ms << " ms and dropped " << last_stream.dropped_frames << " frames");
+        return buffers;
     }
 }
@@ -10,11 +10,13 @@
 #include "core/roi.h"
 #include "core/options.h"
 #include "source.h"
+#include "stream-statistics.h"
 
 #include <chrono>
 #include <memory>
 #include <vector>
 #include <unordered_set>
+#include <map>
 #include <limits.h>
 #include <atomic>
 #include <functional>
@@ -76,7 +78,14 @@ namespace librealsense
         const std::string& get_info(rs2_camera_info info) const override;
         bool supports_info(rs2_camera_info info) const override;
 
+        // Statistics of a stream since the sensor was last opened, created on first use
+        std::shared_ptr<stream_statistics> get_stream_statistics(rs2_stream stream, int index);
+
     protected:
+        void reset_stream_statistics();
+        // Dispatches the frame to the user callback and measures how long the callback took
+        void invoke_callback(frame_holder frame, stream_statistics& statistics);
+
         void raise_on_before_streaming_changes(bool streaming);
         void set_active_streams(const stream_profiles& requests);
         bool try_get_pf(const platform::stream_profile& p, native_pixel_format& result) const;
@@ -105,8 +114,13 @@ namespace librealsense
         stream_profiles _active_profiles;
         std::vector<native_pixel_format> _pixel_formats;
         signal<sensor_base, bool> on_before_streaming_changes;
+        std::mutex _statistics_mutex;
+        std::map<std::pair<rs2_stream, int>, std::shared_ptr<stream_statistics>> _statistics;
     };
 
+    // Accounts a frame evicted from a full frame queue to the streams of the sensors it came from
+    void record_queue_overflow(frame_interface* dropped);
+
     struct frame_timestamp_reader
     {
         virtual ~frame_timestamp_reader() {}
@@ -157,6 +171,7 @@ namespace librealsense
         std::vector<bool> _is_configured_stream;
         std::vector<platform::hid_sensor> _hid_sensors;
         std::map<std::string, request_mapping> _hid_mapping;
+        std::map<std::string, std::shared_ptr<stream_statistics>> _hid_statistics;
         std::unique_ptr<frame_timestamp_reader> _hid_iio_timestamp_reader;
         std::unique_ptr<frame_timestamp_reader> _custom_hid_timestamp_reader;
 
@@ -167,6 +182,14 @@ namespace librealsense
         uint32_t stream_to_fourcc(rs2_stream stream) const;
 
         uint32_t fps_to_sampling_frequency(rs2_stream stream, uint32_t fps) const;
+
+        void publish_sample(const platform::sensor_data& sensor_data);
+
+        // Publish all the samples of a single read as one batched motion frame
+        void publish_batch(const std::vector<platform::sensor_data>& samples);
+
+        bool _batch_motion_samples_option = false;            // Value of the option, changed and queried by the user
+        std::atomic<bool> _batch_motion_samples{ false };     // Read on the capture thread
     };
 
     class uvc_sensor : public sensor_base
@@ -203,6 +226,11 @@ namespace librealsense
         platform::usb_spec get_usb_specification() const { return _device->get_usb_specification(); }
         std::string get_device_path() const { return _device->get_device_location(); }
 
+        // The options of the UVC controls reuse the values they read until a control of the sensor is set, the device raises
+        // a notification, or a command changes the controls through the hw monitor (advanced mode, hardware reset)
+        void invalidate_option_cache() { ++_option_cache_generation; }
+        uint64_t get_option_cache_generation() const { return _option_cache_generation; }
+
     protected:
         stream_profiles init_stream_profiles() override;
 
@@ -215,6 +243,8 @@ namespace librealsense
 
         void reset_streaming();
 
+        int get_frame_buffers(uint32_t fps, const platform::capture_statistics& last_stream) const;
+
         struct power
         {
             explicit power(std::weak_ptr<uvc_sensor> owner)
@@ -249,5 +279,8 @@ namespace librealsense
         std::vector<platform::extension_unit> _xus;
         std::unique_ptr<power> _power;
         std::unique_ptr<frame_timestamp_reader> _timestamp_reader;
+        bool _adaptive_frame_buffers = false;
+        bool _export_dmabuf = false;
+        std::atomic<uint64_t> _option_cache_generation;
     };
 }
@@ -0,0 +1,108 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2015 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "../include/librealsense2/h/rs_types.h"
+
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+
+namespace librealsense
+{
+    // Lock-free latency histogram, see rs2_latency_histogram for the bins
+    class latency_histogram
+    {
+    public:
+        latency_histogram() { reset(); }
+
+        void add(double latency_ms)
+        {
+            if (latency_ms < 0) latency_ms = 0;
+
+            _bins[get_bin(latency_ms)].fetch_add(1, std::memory_order_relaxed);
+            _count.fetch_add(1, std::memory_order_relaxed);
+
+            auto latency_us = static_cast<uint64_t>(latency_ms * 1000);
+            _sum_us.fetch_add(latency_us, std::memory_order_relaxed);
+            auto max_us = _max_us.load(std::memory_order_relaxed);
+            while (latency_us > max_us && !_max_us.compare_exchange_weak(max_us, latency_us, std::memory_order_relaxed));
+        }
+
+        void reset()
+        {
+            for (auto&& bin : _bins) bin = 0;
+            _count = 0;
+            _sum_us = 0;
+            _max_us = 0;
+        }
+
+        // The counters are read one by one, so a snapshot taken while streaming may be off by the samples added meanwhile
+        rs2_latency_histogram get() const
+        {
+            rs2_latency_histogram result{};
+            for (size_t i = 0; i < RS2_LATENCY_HISTOGRAM_BINS; ++i)
+                result.bins[i] = _bins[i].load(std::memory_order_relaxed);
+            result.count = _count.load(std::memory_order_relaxed);
+            result.mean = result.count ? _sum_us.load(std::memory_order_relaxed) / 1000. / result.count : 0;
+            result.max = _max_us.load(std::memory_order_relaxed) / 1000.;
+            return result;
+        }
+
+    private:
+        static size_t get_bin(double latency_ms)
+        {
+            const double first_bin_ms = 0.125;
+            if (latency_ms < first_bin_ms)
+                return 0;
+            auto bin = static_cast<size_t>(std::log2(latency_ms / first_bin_ms)) + 1;
+            return std::min<size_t>(bin, RS2_LATENCY_HISTOGRAM_BINS - 1);
+        }
+
+        std::array<std::atomic<uint64_t>, RS2_LATENCY_HISTOGRAM_BINS> _bins;
+        std::atomic<uint64_t> _count;
+        std::atomic<uint64_t> _sum_us;
+        std::atomic<uint64_t> _max_us;
+    };
+
+    // Counters of a single stream of a sensor, updated on the streaming threads without locks
+    class stream_statistics
+    {
+    public:
+        stream_statistics() { reset(); }
+
+        void reset()
+        {
+            frames_received = 0;
+            kernel_drops = 0;
+            publish_failures = 0;
+            queue_overflows = 0;
+            kernel_to_dequeue.reset();
+            dequeue_to_callback.reset();
+            callback_duration.reset();
+        }
+
+        rs2_stream_statistics get() const
+        {
+            rs2_stream_statistics result{};
+            result.frames_received = frames_received.load(std::memory_order_relaxed);
+            result.kernel_drops = kernel_drops.load(std::memory_order_relaxed);
+            result.publish_failures = publish_failures.load(std::memory_order_relaxed);
+            result.queue_overflows = queue_overflows.load(std::memory_order_relaxed);
+            result.kernel_to_dequeue = kernel_to_dequeue.get();
+            result.dequeue_to_callback = dequeue_to_callback.get();
+            result.callback_duration = callback_duration.get();
+            return result;
+        }
+
+        std::atomic<uint64_t> frames_received;
+        std::atomic<uint64_t> kernel_drops;
+        std::atomic<uint64_t> publish_failures;
+        std::atomic<uint64_t> queue_overflows;
+        latency_histogram kernel_to_dequeue;
+        latency_histogram dequeue_to_callback;
+        latency_histogram callback_duration;
+    };
+}
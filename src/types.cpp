@@ -178,6 +178,7 @@ namespace librealsense
             CASE(TM2)
             CASE(SOFTWARE_DEVICE)
             CASE(SOFTWARE_SENSOR)
+            CASE(DMABUF_FRAME)
         default: assert(!is_valid(value)); return UNKNOWN_VALUE;
         }
 #undef CASE
@@ -197,6 +198,32 @@ namespace librealsense
 #undef CASE
     }
 
+    const char* get_string(rs2_record_compression value)
+    {
+#define CASE(X) STRCASE(RECORD_COMPRESSION, X)
+        switch (value)
+        {
+            CASE(NONE)
+            CASE(LZ4)
+            CASE(LZ4_RVL_DEPTH)
+        default: assert(!is_valid(value)); return UNKNOWN_VALUE;
+        }
+#undef CASE
+    }
+
+    const char* get_string(rs2_record_overflow_policy value)
+    {
+#define CASE(X) STRCASE(RECORD_OVERFLOW, X)
+        switch (value)
+        {
+            CASE(STOP)
+            CASE(DROP)
+            CASE(BLOCK)
+        default: assert(!is_valid(value)); return UNKNOWN_VALUE;
+        }
+#undef CASE
+    }
+
     const char* get_string(rs2_log_severity value)
     {
 #define CASE(X) STRCASE(LOG_SEVERITY, X)
@@ -261,6 +288,11 @@ namespace librealsense
             CASE(HOLES_FILL)
             CASE(AUTO_EXPOSURE_CONVERGE_STEP)
             CASE(INTER_CAM_SYNC_MODE)
+            CASE(MOTION_SAMPLES_BATCHING)
+            CASE(ADAPTIVE_FRAME_BUFFERS)
+            CASE(FRAME_BUFFERS)
+            CASE(DROPPED_FRAMES)
+            CASE(DMABUF_EXPORT)
         default: assert(!is_valid(value)); return UNKNOWN_VALUE;
         }
 #undef CASE
@@ -365,6 +397,8 @@ namespace librealsense
             CASE(MANUAL_WHITE_BALANCE)
             CASE(POWER_LINE_FREQUENCY)
             CASE(LOW_LIGHT_COMPENSATION)
+            CASE(KERNEL_FRAME_SEQUENCE)
+            CASE(DEQUEUE_TIMESTAMP)
 
         default: assert(!is_valid(value)); return UNKNOWN_VALUE;
         }
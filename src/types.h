@@ -405,6 +405,8 @@ namespace librealsense
     RS2_ENUM_HELPERS(rs2_log_severity, LOG_SEVERITY)
     RS2_ENUM_HELPERS(rs2_notification_category, NOTIFICATION_CATEGORY)
     RS2_ENUM_HELPERS(rs2_playback_status, PLAYBACK_STATUS)
+    RS2_ENUM_HELPERS(rs2_record_compression, RECORD_COMPRESSION)
+    RS2_ENUM_HELPERS(rs2_record_overflow_policy, RECORD_OVERFLOW)
     RS2_ENUM_HELPERS(rs2_matchers, MATCHER)
     ////////////////////////////////////////////
     // World's tiniest linear algebra library //
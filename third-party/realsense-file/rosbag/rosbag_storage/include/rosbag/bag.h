@@ -39,6 +39,7 @@
 #include "macros.h"
 
 #include "buffer.h"
+#include "chunk_compressor.h"
 #include "chunked_file.h"
 #include "constants.h"
 #include "exceptions.h"
@@ -54,9 +55,11 @@
 
 #include <ios>
 #include <map>
+#include <memory>
 #include <queue>
 #include <set>
 #include <stdexcept>
+#include <type_traits>
 
 #include <boost/format.hpp>
 //#include <boost/iterator/iterator_facade.hpp>
@@ -72,7 +75,8 @@ namespace bagmode
     {
         Write   = 1,
         Read    = 2,
-        Append  = 4
+        Append  = 4,
+        Mapped  = 8   //!< With Read, chunks are read through a memory mapping of the file, which must not be truncated while open
     };
 }
 typedef bagmode::BagMode BagMode;
@@ -123,6 +127,8 @@ public:
     std::tuple<std::string, uint64_t, uint64_t> getCompressionInfo() const;
     void            setChunkThreshold(uint32_t chunk_threshold);  //!< Set the threshold for creating new chunks
     uint32_t        getChunkThreshold() const;                    //!< Get the threshold for creating new chunks
+    void            setCompressionThreads(uint32_t threads);      //!< Set the number of threads compressing LZ4 chunks ahead of the file write (0 compresses while writing)
+    uint32_t        getCompressionThreads() const;                //!< Get the number of threads compressing LZ4 chunks ahead of the file write
 
     //! Write a message into the bag file
     /*!
@@ -201,12 +207,15 @@ private:
     void appendConnectionRecordToBuffer(Buffer& buf, ConnectionInfo const* connection_info);
     template<class T>
     void writeMessageDataRecord(uint32_t conn_id, ros::Time const& time, T const& msg);
-    void writeIndexRecords();
+    void writeIndexRecords(std::map<uint32_t, std::multiset<IndexEntry> > const& chunk_connection_indexes);
     void writeConnectionRecords();
     void writeChunkInfoRecords();
     void startWritingChunk(ros::Time time);
     void writeChunkHeader(CompressionType compression, uint32_t compressed_size, uint32_t uncompressed_size);
     void stopWritingChunk();
+    void queueChunk();
+    void writeQueuedChunk(OutgoingChunk& chunk);
+    void flushQueuedChunks();
 
     // Reading
 
@@ -231,6 +240,7 @@ private:
     void     decompressRawChunk(ChunkHeader const& chunk_header) const;
     void     decompressBz2Chunk(ChunkHeader const& chunk_header) const;
     void     decompressLz4Chunk(ChunkHeader const& chunk_header) const;
+    uint8_t* readChunkData(uint32_t size) const;
     uint32_t getChunkOffset() const;
 
     // Record header I/O
@@ -277,6 +287,7 @@ private:
     int                 version_;
     CompressionType     compression_;
     uint32_t            chunk_threshold_;
+    uint32_t            compression_threads_;
     uint32_t            bag_revision_;
 
     uint64_t file_size_;
@@ -290,6 +301,10 @@ private:
     ChunkInfo curr_chunk_info_;
     uint64_t  curr_chunk_data_pos_;
 
+    // Chunks are compressed ahead of the file write when set, and written in order once compressed.
+    // Until then, the index entries of a chunk point to a placeholder position past any real offset.
+    std::unique_ptr<ChunkCompressor> chunk_compressor_;
+
     std::map<std::string, uint32_t>                topic_connection_ids_;
     std::map<ros::M_string, uint32_t>              header_connection_ids_;
     std::map<uint32_t, ConnectionInfo*>            connections_;
@@ -306,6 +321,7 @@ private:
     mutable Buffer   decompress_buffer_;       //!< reusable buffer to decompress chunks into
 
     mutable Buffer   outgoing_chunk_buffer_;   //!< reusable buffer to read chunk into
+    Buffer           spare_chunk_buffer_;      //!< outgoing chunk buffer of a written queued chunk, reused for a later chunk
 
     mutable Buffer*  current_buffer_;
 
@@ -543,7 +559,8 @@ void Bag::doWrite(std::string const& topic, ros::Time const& time, T const& msg,
             }
             connections_[conn_id] = connection_info;
 
-            writeConnectionRecord(connection_info);
+            if (!chunk_compressor_)
+                writeConnectionRecord(connection_info);
             appendConnectionRecordToBuffer(outgoing_chunk_buffer_, connection_info);
         }
 
@@ -588,12 +605,14 @@ void Bag::writeMessageDataRecord(uint32_t conn_id, ros::Time const& time, T cons
     // Assemble message in memory first, because we need to write its length
     uint32_t msg_ser_len = ros::serialization::serializationLength(msg);
 
-    record_buffer_.setSize(msg_ser_len);
-
-    ros::serialization::OStream s(record_buffer_.getData(), msg_ser_len);
-
-    // todo: serialize into the outgoing_chunk_buffer & remove record_buffer_
-    ros::serialization::serialize(s, msg);
+    // A MessageInstance of our own bag may be read from outgoing_chunk_buffer_, so it is serialized aside first.
+    // Other messages are serialized straight into the chunk, which is then written to the file from there
+    bool serialize_aside = std::is_same<T, MessageInstance>::value;
+    if (serialize_aside) {
+        record_buffer_.setSize(msg_ser_len);
+        ros::serialization::OStream s(record_buffer_.getData(), msg_ser_len);
+        ros::serialization::serialize(s, msg);
+    }
 
     // We do an extra seek here since writing our data record may
     // have indirectly moved our file-pointer if it was a
@@ -604,17 +623,24 @@ void Bag::writeMessageDataRecord(uint32_t conn_id, ros::Time const& time, T cons
     CONSOLE_BRIDGE_logDebug("Writing MSG_DATA [%llu:%d]: conn=%d sec=%d nsec=%d data_len=%d",
               (unsigned long long) file_.getOffset(), getChunkOffset(), conn_id, time.sec, time.nsec, msg_ser_len);
 
-    writeHeader(header);
-    writeDataLength(msg_ser_len);
-    write((char*) record_buffer_.getData(), msg_ser_len);
-
     // todo: use better abstraction than appendHeaderToBuffer
+    uint32_t record_offset = outgoing_chunk_buffer_.getSize();
     appendHeaderToBuffer(outgoing_chunk_buffer_, header);
     appendDataLengthToBuffer(outgoing_chunk_buffer_, msg_ser_len);
 
     uint32_t offset = outgoing_chunk_buffer_.getSize();
     outgoing_chunk_buffer_.setSize(outgoing_chunk_buffer_.getSize() + msg_ser_len);
-    memcpy(outgoing_chunk_buffer_.getData() + offset, record_buffer_.getData(), msg_ser_len);
+    if (serialize_aside) {
+        memcpy(outgoing_chunk_buffer_.getData() + offset, record_buffer_.getData(), msg_ser_len);
+    }
+    else {
+        ros::serialization::OStream s(outgoing_chunk_buffer_.getData() + offset, msg_ser_len);
+        ros::serialization::serialize(s, msg);
+    }
+
+    // Chunks compressed ahead of the write are written in one piece from outgoing_chunk_buffer_
+    if (!chunk_compressor_)
+        write((char*) outgoing_chunk_buffer_.getData() + record_offset, outgoing_chunk_buffer_.getSize() - record_offset);
 
     // Update the current chunk time range
     if (time > curr_chunk_info_.end_time)
@@ -51,6 +51,8 @@ public:
     uint32_t getSize()     const;
 
     void setSize(uint32_t size);
+    void setView(uint8_t* data, uint32_t size); //!< refer to data held elsewhere (a mapped file) instead, until the next setSize
+    void swap(Buffer& other);               //!< exchange the content of two buffers, without copying it
 
 private:
     void ensureCapacity(uint32_t capacity);
@@ -59,6 +61,7 @@ private:
     uint8_t* buffer_;
     uint32_t capacity_;
     uint32_t size_;
+    uint8_t* view_;
 };
 
 } // namespace rosbag
@@ -0,0 +1,67 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2017 Intel Corporation. All Rights Reserved.
+
+#ifndef ROSBAG_CHUNK_COMPRESSOR_H
+#define ROSBAG_CHUNK_COMPRESSOR_H
+
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "buffer.h"
+#include "macros.h"
+#include "stream.h"
+#include "structures.h"
+
+namespace rosbag {
+
+//! A finished chunk, handed to the compression workers and back to the bag for writing
+struct ROSBAG_DECL OutgoingChunk
+{
+    uint32_t             index;              //!< position of the chunk in the chunk list of the bag
+    uint64_t             placeholder_pos;    //!< chunk_pos of the index entries until the chunk is written
+    CompressionType      compression;
+    uint32_t             uncompressed_size;
+    Buffer               records;            //!< the uncompressed chunk records
+    std::vector<uint8_t> data;               //!< the chunk records, once compressed
+    std::map<uint32_t, std::multiset<IndexEntry> > connection_indexes;
+
+    bool                 compressed;
+    std::string          error;              //!< set when the chunk could not be compressed
+};
+
+//! ChunkCompressor compresses chunks on a pool of worker threads, and returns them in the order they were pushed
+class ROSBAG_DECL ChunkCompressor
+{
+public:
+    ChunkCompressor(uint32_t threads);
+    ~ChunkCompressor();
+
+    void push(std::shared_ptr<OutgoingChunk> chunk);     //!< Queue a chunk for compression
+    std::shared_ptr<OutgoingChunk> pop(bool wait);       //!< Oldest chunk once compressed, null if it is not ready or none is pending
+    size_t size() const;                                 //!< Number of chunks pushed and not popped yet
+
+private:
+    void run();
+    static void compress(OutgoingChunk& chunk);
+
+    std::vector<std::thread> workers_;
+
+    mutable std::mutex      mutex_;
+    std::condition_variable work_cv_;
+    std::condition_variable done_cv_;
+    bool                    stopping_;
+
+    std::deque<std::shared_ptr<OutgoingChunk> > todo_;     //!< chunks waiting for a worker
+    std::deque<std::shared_ptr<OutgoingChunk> > pending_;  //!< all the chunks not popped yet, in push order
+};
+
+} // namespace rosbag
+
+#endif
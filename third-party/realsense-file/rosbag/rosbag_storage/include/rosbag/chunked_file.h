@@ -75,12 +75,15 @@ public:
     void        read(void* ptr, size_t size);                           //!< read size bytes from the file into ptr
     std::string getline();
     bool        truncate(uint64_t length);
+    bool        map();                                                  //!< map the file open for reading into memory, returns false when it cannot be
+    uint8_t*    getMapped(uint64_t offset, uint64_t size) const;        //!< return the mapped data at offset, NULL when not mapped
     void        seek(uint64_t offset, int origin = std::ios_base::beg); //!< seek to given offset from origin
     void        decompress(CompressionType compression, uint8_t* dest, unsigned int dest_len, uint8_t* source, unsigned int source_len);
 
 private:
     void open(std::string const& filename, std::string const& mode);
     void clearUnused();
+    void unmap();
 
 private:
     std::string filename_;       //!< path to file
@@ -89,6 +92,9 @@ private:
     uint64_t    compressed_in_;  //!< number of bytes written to current compressed stream
     char*       unused_;         //!< extra data read by compressed stream
     int         nUnused_;        //!< number of bytes of extra data read by compressed stream
+    uint8_t*    mapped_;         //!< mapping of the whole file, when mapped
+    uint64_t    mapped_size_;    //!< size of the file when it was mapped
+    void*       mapping_;        //!< handle of the file mapping object (Windows only)
 
 	std::shared_ptr<StreamFactory> stream_factory_;
 
@@ -64,6 +64,7 @@ Bag::Bag() :
     version_(0),
     compression_(compression::Uncompressed),
     chunk_threshold_(768 * 1024),  // 768KB chunks
+    compression_threads_(0),
     bag_revision_(0),
     file_size_(0),
     file_header_pos_(0),
@@ -80,6 +81,7 @@ Bag::Bag() :
 Bag::Bag(string const& filename, uint32_t mode) :
     compression_(compression::Uncompressed),
     chunk_threshold_(768 * 1024),  // 768KB chunks
+    compression_threads_(0),
     bag_revision_(0),
     file_size_(0),
     file_header_pos_(0),
@@ -119,6 +121,8 @@ void Bag::open(string const& filename, uint32_t mode) {
 
 void Bag::openRead(string const& filename) {
     file_.openRead(filename);
+    if ((mode_ & bagmode::Mapped) && !file_.map())
+        CONSOLE_BRIDGE_logDebug("Could not map %s, reading it through the file instead", filename.c_str());
 
     readVersion();
 
@@ -166,6 +170,11 @@ void Bag::close() {
         closeWrite();
 
     file_.close();
+    chunk_compressor_.reset();
+
+    // The decompressed chunk may refer to the mapping of the file
+    decompressed_chunk_ = 0;
+    decompress_buffer_.setSize(0);
 
     topic_connection_ids_.clear();
     header_connection_ids_.clear();
@@ -194,6 +203,16 @@ void Bag::setChunkThreshold(uint32_t chunk_threshold) {
     chunk_threshold_ = chunk_threshold;
 }
 
+uint32_t Bag::getCompressionThreads() const { return compression_threads_; }
+
+void Bag::setCompressionThreads(uint32_t threads) {
+    if (file_.isOpen() && chunk_open_)
+        stopWritingChunk();
+    flushQueuedChunks();
+
+    compression_threads_ = threads;
+}
+
 CompressionType Bag::getCompression() const { return compression_; }
 
 std::tuple<std::string, uint64_t, uint64_t> Bag::getCompressionInfo() const
@@ -248,6 +267,7 @@ void Bag::setCompression(CompressionType compression) {
         throw BagException(
             (format("Unknown compression type: %i")  % compression).str());
     }
+    flushQueuedChunks();
 
     compression_ = compression;
 }
@@ -297,6 +317,7 @@ void Bag::startWriting() {
 void Bag::stopWriting() {
     if (chunk_open_)
         stopWritingChunk();
+    flushQueuedChunks();
 
     seek(0, std::ios::end);
 
@@ -442,7 +463,9 @@ void Bag::readFileHeaderRecord() {
 }
 
 uint32_t Bag::getChunkOffset() const {
-    if (compression_ == compression::Uncompressed)
+    if (chunk_compressor_)
+        return outgoing_chunk_buffer_.getSize();
+    else if (compression_ == compression::Uncompressed)
         return static_cast<uint32_t>(file_.getOffset() - curr_chunk_data_pos_);
     else
         return file_.getCompressedBytesIn();
@@ -454,6 +477,17 @@ void Bag::startWritingChunk(Time time) {
     curr_chunk_info_.start_time = time;
     curr_chunk_info_.end_time   = time;
 
+    // LZ4 chunks are assembled in outgoing_chunk_buffer_ only, and compressed by the workers when finished
+    if (compression_threads_ > 0 && compression_ == compression::LZ4) {
+        if (!chunk_compressor_)
+            chunk_compressor_.reset(new ChunkCompressor(compression_threads_));
+
+        curr_chunk_info_.pos = (uint64_t(1) << 63) + chunks_.size();
+        curr_chunk_data_pos_ = 0;
+        chunk_open_ = true;
+        return;
+    }
+
     // Write the chunk header, with a place-holder for the data sizes (we'll fill in when the chunk is finished)
     writeChunkHeader(compression_, 0, 0);
 
@@ -467,6 +501,11 @@ void Bag::startWritingChunk(Time time) {
 }
 
 void Bag::stopWritingChunk() {
+    if (chunk_compressor_) {
+        queueChunk();
+        return;
+    }
+
     // Add this chunk to the index
     chunks_.push_back(curr_chunk_info_);
 
@@ -483,7 +522,7 @@ void Bag::stopWritingChunk() {
 
     // Write out the indexes and clear them
     seek(end_of_chunk_pos);
-    writeIndexRecords();
+    writeIndexRecords(curr_chunk_connection_indexes_);
     curr_chunk_connection_indexes_.clear();
 
     // Clear the connection counts
@@ -493,6 +532,72 @@ void Bag::stopWritingChunk() {
     chunk_open_ = false;
 }
 
+void Bag::queueChunk() {
+    // Add this chunk to the index, its position is known once the chunks queued before it are written
+    chunks_.push_back(curr_chunk_info_);
+
+    std::shared_ptr<OutgoingChunk> chunk = std::make_shared<OutgoingChunk>();
+    chunk->index             = static_cast<uint32_t>(chunks_.size() - 1);
+    chunk->placeholder_pos   = curr_chunk_info_.pos;
+    chunk->compression       = compression_;
+    chunk->uncompressed_size = outgoing_chunk_buffer_.getSize();
+    chunk->connection_indexes.swap(curr_chunk_connection_indexes_);
+
+    // The records are handed over as is, and the next chunk is assembled in the buffer of an already written one
+    chunk->records.swap(outgoing_chunk_buffer_);
+    outgoing_chunk_buffer_.swap(spare_chunk_buffer_);
+    outgoing_chunk_buffer_.setSize(0);
+
+    // Bound the memory held by queued chunks, by writing out the oldest ones
+    while (chunk_compressor_->size() >= 2 * compression_threads_)
+        writeQueuedChunk(*chunk_compressor_->pop(true));
+    chunk_compressor_->push(chunk);
+
+    // Write whatever is compressed already, keeping the chunks in order
+    while (std::shared_ptr<OutgoingChunk> compressed = chunk_compressor_->pop(false))
+        writeQueuedChunk(*compressed);
+
+    curr_chunk_info_.connection_counts.clear();
+    chunk_open_ = false;
+}
+
+void Bag::writeQueuedChunk(OutgoingChunk& chunk) {
+    if (!chunk.error.empty())
+        throw BagIOException(chunk.error);
+
+    seek(0, std::ios::end);
+    uint64_t chunk_pos = file_.getOffset();
+    chunks_[chunk.index].pos = chunk_pos;
+
+    writeChunkHeader(chunk.compression, static_cast<uint32_t>(chunk.data.size()), chunk.uncompressed_size);
+    write((char*) chunk.data.data(), chunk.data.size());
+    writeIndexRecords(chunk.connection_indexes);
+    file_size_ = file_.getOffset();
+
+    if (chunk.records.getCapacity() > spare_chunk_buffer_.getCapacity())
+        spare_chunk_buffer_.swap(chunk.records);
+
+    // Point the connection indexes at the written chunk. The position is not part of the ordering of the entries
+    for (map<uint32_t, multiset<IndexEntry> >::const_iterator i = chunk.connection_indexes.begin(); i != chunk.connection_indexes.end(); i++) {
+        multiset<IndexEntry>& connection_index = connection_indexes_[i->first];
+        foreach(IndexEntry const& e, i->second) {
+            std::pair<multiset<IndexEntry>::iterator, multiset<IndexEntry>::iterator> range = connection_index.equal_range(e);
+            for (multiset<IndexEntry>::iterator j = range.first; j != range.second; j++)
+                if (j->chunk_pos == chunk.placeholder_pos)
+                    const_cast<IndexEntry&>(*j).chunk_pos = chunk_pos;
+        }
+    }
+}
+
+void Bag::flushQueuedChunks() {
+    if (!chunk_compressor_)
+        return;
+
+    while (std::shared_ptr<OutgoingChunk> chunk = chunk_compressor_->pop(true))
+        writeQueuedChunk(*chunk);
+    chunk_compressor_.reset();
+}
+
 void Bag::writeChunkHeader(CompressionType compression, uint32_t compressed_size, uint32_t uncompressed_size) {
     ChunkHeader chunk_header;
     switch (compression) {
@@ -534,8 +639,8 @@ void Bag::readChunkHeader(ChunkHeader& chunk_header) const {
 
 // Index records
 
-void Bag::writeIndexRecords() {
-    for (map<uint32_t, multiset<IndexEntry> >::const_iterator i = curr_chunk_connection_indexes_.begin(); i != curr_chunk_connection_indexes_.end(); i++) {
+void Bag::writeIndexRecords(map<uint32_t, multiset<IndexEntry> > const& chunk_connection_indexes) {
+    for (map<uint32_t, multiset<IndexEntry> >::const_iterator i = chunk_connection_indexes.begin(); i != chunk_connection_indexes.end(); i++) {
         uint32_t                    connection_id = i->first;
         multiset<IndexEntry> const& index         = i->second;
 
@@ -838,13 +943,33 @@ void Bag::readMessageDataRecord102(uint64_t offset, ros::Header& header) const {
     file_.read((char*) record_buffer_.getData(), data_size);
 }
 
-// Reading this into a buffer isn't completely necessary, but we do it anyways for now
+// Returns the chunk data at the current position: from the mapping of the file when it is mapped, read into chunk_buffer_ otherwise
+uint8_t* Bag::readChunkData(uint32_t size) const {
+    uint8_t* mapped = file_.getMapped(file_.getOffset(), size);
+    if (mapped) {
+        seek(file_.getOffset() + size);
+        return mapped;
+    }
+
+    chunk_buffer_.setSize(size);
+    file_.read((char*) chunk_buffer_.getData(), size);
+    return chunk_buffer_.getData();
+}
+
+// When the file is mapped, the messages of an uncompressed chunk are read from the mapping, without copying the chunk
 void Bag::decompressRawChunk(ChunkHeader const& chunk_header) const {
     assert(chunk_header.compression == COMPRESSION_NONE);
     assert(chunk_header.compressed_size == chunk_header.uncompressed_size);
 
     CONSOLE_BRIDGE_logDebug("compressed_size: %d uncompressed_size: %d", chunk_header.compressed_size, chunk_header.uncompressed_size);
 
+    uint8_t* mapped = file_.getMapped(file_.getOffset(), chunk_header.compressed_size);
+    if (mapped) {
+        decompress_buffer_.setView(mapped, chunk_header.compressed_size);
+        seek(file_.getOffset() + chunk_header.compressed_size);
+        return;
+    }
+
     decompress_buffer_.setSize(chunk_header.compressed_size);
     file_.read((char*) decompress_buffer_.getData(), chunk_header.compressed_size);
 
@@ -858,11 +983,10 @@ void Bag::decompressBz2Chunk(ChunkHeader const& chunk_header) const {
 
     CONSOLE_BRIDGE_logDebug("compressed_size: %d uncompressed_size: %d", chunk_header.compressed_size, chunk_header.uncompressed_size);
 
-    chunk_buffer_.setSize(chunk_header.compressed_size);
-    file_.read((char*) chunk_buffer_.getData(), chunk_header.compressed_size);
+    uint8_t* data = readChunkData(chunk_header.compressed_size);
 
     decompress_buffer_.setSize(chunk_header.uncompressed_size);
-    file_.decompress(compression, decompress_buffer_.getData(), decompress_buffer_.getSize(), chunk_buffer_.getData(), chunk_buffer_.getSize());
+    file_.decompress(compression, decompress_buffer_.getData(), decompress_buffer_.getSize(), data, chunk_header.compressed_size);
 
     // todo check read was successful
 }
@@ -875,11 +999,10 @@ void Bag::decompressLz4Chunk(ChunkHeader const& chunk_header) const {
     CONSOLE_BRIDGE_logDebug("lz4 compressed_size: %d uncompressed_size: %d",
              chunk_header.compressed_size, chunk_header.uncompressed_size);
 
-    chunk_buffer_.setSize(chunk_header.compressed_size);
-    file_.read((char*) chunk_buffer_.getData(), chunk_header.compressed_size);
+    uint8_t* data = readChunkData(chunk_header.compressed_size);
 
     decompress_buffer_.setSize(chunk_header.uncompressed_size);
-    file_.decompress(compression, decompress_buffer_.getData(), decompress_buffer_.getSize(), chunk_buffer_.getData(), chunk_buffer_.getSize());
+    file_.decompress(compression, decompress_buffer_.getData(), decompress_buffer_.getSize(), data, chunk_header.compressed_size);
 
     // todo check read was successful
 }
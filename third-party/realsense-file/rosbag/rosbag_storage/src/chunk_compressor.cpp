@@ -0,0 +1,126 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2017 Intel Corporation. All Rights Reserved.
+
+#include "rosbag/chunk_compressor.h"
+#include "rosbag/exceptions.h"
+
+#include "console_bridge/console.h"
+
+#include <algorithm>
+
+namespace rosbag {
+
+// Same block size as LZ4Stream, so that chunks compressed either way read alike
+static const int CHUNK_COMPRESSOR_LZ4_BLOCK_SIZE_ID = 6;
+
+ChunkCompressor::ChunkCompressor(uint32_t threads) : stopping_(false) {
+    for (uint32_t i = 0; i < std::max<uint32_t>(threads, 1); i++)
+        workers_.push_back(std::thread([this]() { run(); }));
+}
+
+ChunkCompressor::~ChunkCompressor() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    work_cv_.notify_all();
+    for (std::thread& worker : workers_)
+        worker.join();
+}
+
+void ChunkCompressor::push(std::shared_ptr<OutgoingChunk> chunk) {
+    chunk->compressed = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        todo_.push_back(chunk);
+        pending_.push_back(chunk);
+    }
+    work_cv_.notify_one();
+}
+
+std::shared_ptr<OutgoingChunk> ChunkCompressor::pop(bool wait) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (wait)
+        done_cv_.wait(lock, [this]() { return pending_.empty() || pending_.front()->compressed; });
+
+    if (pending_.empty() || !pending_.front()->compressed)
+        return std::shared_ptr<OutgoingChunk>();
+
+    std::shared_ptr<OutgoingChunk> chunk = pending_.front();
+    pending_.pop_front();
+    return chunk;
+}
+
+size_t ChunkCompressor::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return pending_.size();
+}
+
+void ChunkCompressor::run() {
+    while (true) {
+        std::shared_ptr<OutgoingChunk> chunk;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            work_cv_.wait(lock, [this]() { return stopping_ || !todo_.empty(); });
+            if (stopping_)
+                return;
+            chunk = todo_.front();
+            todo_.pop_front();
+        }
+
+        try {
+            compress(*chunk);
+        }
+        catch (std::exception const& ex) {
+            chunk->error = ex.what();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            chunk->compressed = true;
+        }
+        done_cv_.notify_all();
+    }
+}
+
+void ChunkCompressor::compress(OutgoingChunk& chunk) {
+    switch (chunk.compression) {
+    case compression::Uncompressed:
+        chunk.data.assign(chunk.records.getData(), chunk.records.getData() + chunk.records.getSize());
+        return;
+    case compression::LZ4:
+        break;
+    default:
+        throw BagException("Chunk compression is supported only for LZ4");
+    }
+
+    // Blocks that do not compress are stored as is, so the frame is never larger than this
+    uint32_t block_size  = roslz4_blockSizeFromIndex(CHUNK_COMPRESSOR_LZ4_BLOCK_SIZE_ID);
+    uint32_t block_count = chunk.records.getSize() / block_size + 1;
+    std::vector<uint8_t> output(chunk.records.getSize() + 4 * block_count + 16);
+
+    roslz4_stream lz4s;
+    int ret = roslz4_compressStart(&lz4s, CHUNK_COMPRESSOR_LZ4_BLOCK_SIZE_ID);
+    if (ret != ROSLZ4_OK)
+        throw BagIOException("ROSLZ4_MEMORY_ERROR: insufficient memory available");
+
+    lz4s.input_next  = reinterpret_cast<char*>(chunk.records.getData());
+    lz4s.input_left  = static_cast<int>(chunk.records.getSize());
+    lz4s.output_next = reinterpret_cast<char*>(output.data());
+    lz4s.output_left = static_cast<int>(output.size());
+
+    do {
+        ret = roslz4_compress(&lz4s, ROSLZ4_FINISH);
+    } while (ret == ROSLZ4_OK);
+
+    output.resize(output.size() - lz4s.output_left);
+    roslz4_compressEnd(&lz4s);
+
+    if (ret != ROSLZ4_STREAM_END)
+        throw BagIOException("ROSLZ4_ERROR: chunk compression error");
+
+    CONSOLE_BRIDGE_logDebug("Compressed chunk %d: %d -> %d bytes", chunk.index, chunk.uncompressed_size, (int) output.size());
+    chunk.data.swap(output);
+}
+
+} // namespace rosbag
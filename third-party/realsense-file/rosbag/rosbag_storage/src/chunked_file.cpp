@@ -51,6 +51,14 @@
 #        define fileno _fileno
 #        define ftruncate _chsize_s //Intel Realsense Change, Was: #define ftruncate _chsize 
 #    endif
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <io.h>
+#    include <windows.h>
+#else
+#    include <sys/mman.h>
+#    include <sys/stat.h>
 #endif
 
 using std::string;
@@ -65,7 +73,10 @@ ChunkedFile::ChunkedFile() :
     offset_(0),
     compressed_in_(0),
     unused_(NULL),
-    nUnused_(0)
+    nUnused_(0),
+    mapped_(NULL),
+    mapped_size_(0),
+    mapping_(NULL)
 {
     stream_factory_ = std::make_shared<StreamFactory>(this);
 }
@@ -138,6 +149,8 @@ void ChunkedFile::close() {
     // Close any compressed stream by changing to uncompressed mode
     setWriteMode(compression::Uncompressed);
 
+    unmap();
+
     // Close the file
     int success = fclose(file_);
     if (success != 0)
@@ -200,6 +213,69 @@ bool ChunkedFile::truncate(uint64_t length) {
     return ftruncate(fd, length) == 0;
 }
 
+// The whole file is mapped at once: it is only worth it where the address space is not a constraint
+bool ChunkedFile::map() {
+    if (!file_)
+        throw BagIOException("Can't map - file not open");
+    if (mapped_)
+        return true;
+    if (sizeof(void*) < 8)
+        return false;
+
+#ifdef _WIN32
+    HANDLE handle = (HANDLE) _get_osfhandle(fileno(file_));
+    LARGE_INTEGER size;
+    if (handle == INVALID_HANDLE_VALUE || !GetFileSizeEx(handle, &size) || size.QuadPart <= 0)
+        return false;
+
+    HANDLE mapping = CreateFileMapping(handle, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapping == NULL)
+        return false;
+
+    void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (data == NULL) {
+        CloseHandle(mapping);
+        return false;
+    }
+    mapping_     = mapping;
+    mapped_size_ = (uint64_t) size.QuadPart;
+#else
+    struct stat st;
+    if (fstat(fileno(file_), &st) != 0 || st.st_size <= 0)
+        return false;
+
+    void* data = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_SHARED, fileno(file_), 0);
+    if (data == MAP_FAILED)
+        return false;
+    mapped_size_ = (uint64_t) st.st_size;
+#endif
+
+    mapped_ = (uint8_t*) data;
+    return true;
+}
+
+void ChunkedFile::unmap() {
+    if (!mapped_)
+        return;
+
+#ifdef _WIN32
+    UnmapViewOfFile(mapped_);
+    CloseHandle((HANDLE) mapping_);
+    mapping_ = NULL;
+#else
+    munmap(mapped_, (size_t) mapped_size_);
+#endif
+
+    mapped_      = NULL;
+    mapped_size_ = 0;
+}
+
+uint8_t* ChunkedFile::getMapped(uint64_t offset, uint64_t size) const {
+    if (!mapped_ || offset > mapped_size_ || size > mapped_size_ - offset)
+        return NULL;
+    return mapped_ + offset;
+}
+
 //! \todo add error handling
 string ChunkedFile::getline() {
     char buffer[1024];
@@ -19,6 +19,8 @@
 #include <vector>
 #include <fstream>
 #include <array>
+#include <chrono>
+#include <functional>
 #include "../src/types.h"
 
 // noexcept is not accepted by Visual Studio 2013 yet, but noexcept(false) is require on throwing destructors on gcc and clang
@@ -142,6 +144,55 @@ inline bool make_context(const char* id, rs2::context* ctx, std::string min_api_
 
 }
 
+// Defined by each test executable, disables the options that are sensitive to frame content
+void disable_sensitive_options_for(rs2::device& dev);
+
+// Starts a pipeline that records its streams to filename
+// configure may adjust the recording config, e.g. its compression
+inline rs2::pipeline_profile start_recording(rs2::pipeline& p, const std::string& filename,
+    std::function<void(rs2::config&)> configure = nullptr)
+{
+    rs2::config cfg;
+    REQUIRE_NOTHROW(cfg.enable_record_to_file(filename));
+    if (configure)
+        configure(cfg);
+    rs2::pipeline_profile profile;
+    REQUIRE_NOTHROW(profile = cfg.resolve(p));
+    REQUIRE(profile);
+    auto dev = profile.get_device();
+    REQUIRE(dev);
+    disable_sensitive_options_for(dev);
+    REQUIRE_NOTHROW(profile = p.start(cfg));
+    return profile;
+}
+
+// Records the streams of the device for the given duration and requires the file to be written
+inline void record_to_file(const rs2::context& ctx, const std::string& filename, std::chrono::milliseconds duration,
+    std::function<void(rs2::config&)> configure = nullptr)
+{
+    {
+        rs2::pipeline p(ctx);
+        start_recording(p, filename, configure);
+        std::this_thread::sleep_for(duration);
+        REQUIRE_NOTHROW(p.stop());
+    }
+    REQUIRE(file_exists(filename));
+}
+
+// Plays the recording back through a pipeline and requires it to deliver a frameset
+inline void require_playback_frames(const rs2::context& ctx, const std::string& filename, unsigned int timeout_ms = 1000)
+{
+    rs2::pipeline p(ctx);
+    rs2::config cfg;
+    REQUIRE_NOTHROW(cfg.enable_device_from_file(filename));
+    REQUIRE_NOTHROW(p.start(cfg));
+    rs2::frameset frames;
+    REQUIRE_NOTHROW(frames = p.wait_for_frames(timeout_ms));
+    REQUIRE(frames);
+    REQUIRE(frames.size() > 0);
+    REQUIRE_NOTHROW(p.stop());
+}
+
 // Can be passed to rs2_error ** parameters, requires that an error is indicated with the specific provided message
 class require_error
 {
@@ -10,6 +10,7 @@
 #include <chrono>
 #include <ctime>
 #include <algorithm>
+#include <future>
 
 #include "unit-tests-common.h"
 #include "../include/librealsense2/rs_advanced_mode.hpp"
@@ -20,6 +21,15 @@
 #include <../src/proc/disparity-transform.h>
 #include <../src/proc/spatial-filter.h>
 #include <../src/proc/temporal-filter.h>
+#include <../src/calibration-cache.h>
+#include <../src/media/ros/rvl_codec.h>
+#include <../src/media/playback/read_ahead_reader.h>
+#include <../src/media/ros/ros_frame_index.h>
+#include <../src/media/record/record_write_buffer.h>
+#include <rosbag/bag.h>
+#include <rosbag/view.h>
+#include <std_msgs/String.h>
+#include <std_msgs/UInt32.h>
 
 using namespace rs2;
 using namespace librealsense;  // An internal namespace not acessible via the public API
@@ -4207,6 +4217,467 @@ TEST_CASE("Pipeline record and playback", "[live]") {
 }
 
 
+TEST_CASE("Pipeline record with chunk compression and playback", "[live]") {
+    rs2::context ctx;
+
+    if (make_context(SECTION_FROM_TEST_NAME, &ctx))
+    {
+        for (auto compression : { RS2_RECORD_COMPRESSION_NONE, RS2_RECORD_COMPRESSION_LZ4 })
+        {
+            CAPTURE(rs2_record_compression_to_string(compression));
+            const std::string filename = get_folder_path(special_folder::temp_folder) + "test_compressed_file.bag";
+            record_to_file(ctx, filename, std::chrono::seconds(3), [&](rs2::config& cfg)
+            {
+                // Small chunks, so that several are queued for compression at once
+                REQUIRE_NOTHROW(cfg.enable_record_to_file(filename, compression, 64 * 1024, 2));
+            });
+            require_playback_frames(ctx, filename);
+        }
+    }
+}
+
+TEST_CASE("Bag chunks compressed on worker threads match the streaming compressor", "[bag-compression]") {
+    struct bag_message
+    {
+        std::string topic;
+        ros::Time time;
+        std::string text;
+        uint32_t value;
+    };
+
+    // Compressed while writing, then ahead of the write on one and on several threads
+    std::vector<std::vector<bag_message>> read_back;
+    std::vector<std::vector<char>> contents;
+    for (uint32_t threads : { 0u, 1u, 3u })
+    {
+        CAPTURE(threads);
+        const std::string filename = get_folder_path(special_folder::temp_folder) + "test_chunk_compression_" + std::to_string(threads) + ".bag";
+        {
+            rosbag::Bag bag;
+            bag.open(filename, rosbag::BagMode::Write);
+            // Small chunks, so that several are queued for compression at once
+            bag.setChunkThreshold(4 * 1024);
+            bag.setCompression(rosbag::CompressionType::LZ4);
+            bag.setCompressionThreads(threads);
+            REQUIRE(bag.getCompressionThreads() == threads);
+
+            // Messages of varying sizes, partly noise so that chunks compress to different sizes
+            uint32_t state = 1;
+            for (uint32_t i = 0; i < 2000; ++i)
+            {
+                ros::Time time(1, i * 1000);
+                std_msgs::String text;
+                text.data = std::string(1 + i % 97, static_cast<char>('a' + i % 26));
+                for (size_t j = 0; j < text.data.size(); j += 5)
+                {
+                    state = state * 1103515245 + 12345;
+                    text.data[j] = static_cast<char>(state >> 24);
+                }
+                bag.write("/text", time, text);
+                if (i % 3 == 0)
+                {
+                    std_msgs::UInt32 value;
+                    value.data = i;
+                    bag.write("/value", time, value);
+                }
+            }
+            bag.close();
+        }
+
+        std::ifstream file(filename, std::ios::binary);
+        REQUIRE(file.good());
+        contents.emplace_back(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        file.close();
+
+        rosbag::Bag bag;
+        bag.open(filename, rosbag::BagMode::Read);
+        REQUIRE(std::get<0>(bag.getCompressionInfo()) == "lz4");
+        std::vector<bag_message> messages;
+        rosbag::View view(bag);
+        for (auto&& m : view)
+        {
+            bag_message message{ m.getTopic(), m.getTime(), "", 0 };
+            if (m.getTopic() == "/text")
+                message.text = m.instantiate<std_msgs::String>()->data;
+            else
+                message.value = m.instantiate<std_msgs::UInt32>()->data;
+            messages.push_back(message);
+        }
+        bag.close();
+        REQUIRE(messages.size() == 2000 + 667);
+        read_back.push_back(messages);
+        std::remove(filename.c_str());
+    }
+
+    for (size_t i = 1; i < read_back.size(); ++i)
+    {
+        // The chunks are written in order, with the same headers and indexes, so the files are identical
+        REQUIRE(contents[i] == contents[0]);
+        REQUIRE(read_back[i].size() == read_back[0].size());
+        for (size_t j = 0; j < read_back[0].size(); ++j)
+        {
+            REQUIRE(read_back[i][j].topic == read_back[0][j].topic);
+            REQUIRE(read_back[i][j].time == read_back[0][j].time);
+            REQUIRE(read_back[i][j].text == read_back[0][j].text);
+            REQUIRE(read_back[i][j].value == read_back[0][j].value);
+        }
+    }
+}
+
+TEST_CASE("Recording rotates files", "[live]") {
+    rs2::context ctx;
+
+    if (make_context(SECTION_FROM_TEST_NAME, &ctx))
+    {
+        const std::string folder = get_folder_path(special_folder::temp_folder);
+        const std::string filename = folder + "test_rotation.bag";
+        {
+            rs2::pipeline p(ctx);
+            auto profile = start_recording(p, filename);
+            auto recorder = profile.get_device().as<rs2::recorder>();
+            REQUIRE(recorder);
+            REQUIRE_NOTHROW(recorder.set_rotation(0, std::chrono::seconds(1)));
+            std::this_thread::sleep_for(std::chrono::milliseconds(3500));
+            REQUIRE(recorder.filename() != filename);
+            REQUIRE_NOTHROW(p.stop());
+        }
+
+        // Every file is a recording of its own, with the sensors and streams of the device
+        unsigned long long last_frame_number = 0;
+        for (auto&& file : { filename, folder + "test_rotation_1.bag", folder + "test_rotation_2.bag" })
+        {
+            CAPTURE(file);
+            REQUIRE(file_exists(file));
+            auto playback = ctx.load_device(file).as<rs2::playback>();
+            REQUIRE(playback);
+            REQUIRE(playback.get_duration() < std::chrono::seconds(2));
+            REQUIRE(playback.query_sensors().size() > 0);
+            for (auto&& sensor : playback.query_sensors())
+            {
+                for (auto&& stream : sensor.get_stream_profiles())
+                {
+                    auto count = playback.get_frame_count(stream);
+                    if (count == 0 || stream.stream_type() != RS2_STREAM_DEPTH)
+                        continue;
+                    // No frame is lost or repeated between the files
+                    auto first = playback.get_frame(stream, 0).get_frame_number();
+                    REQUIRE(first > last_frame_number);
+                    last_frame_number = playback.get_frame(stream, count - 1).get_frame_number();
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Recorder write buffer policies", "[live]") {
+    rs2::context ctx;
+
+    if (make_context(SECTION_FROM_TEST_NAME, &ctx))
+    {
+        for (auto policy : { RS2_RECORD_OVERFLOW_DROP, RS2_RECORD_OVERFLOW_BLOCK })
+        {
+            CAPTURE(rs2_record_overflow_policy_to_string(policy));
+            const std::string filename = get_folder_path(special_folder::temp_folder) + "test_write_buffer.bag";
+            std::vector<rs2::stream_profile> streams;
+            unsigned long long dropped = 0;
+            {
+                rs2::pipeline p(ctx);
+                auto profile = start_recording(p, filename);
+                auto recorder = profile.get_device().as<rs2::recorder>();
+                REQUIRE(recorder);
+                REQUIRE_THROWS(recorder.set_write_buffer(0, RS2_RECORD_OVERFLOW_COUNT));
+                // A single frame fills the buffer, the frames of the other streams overflow it
+                REQUIRE_NOTHROW(recorder.set_write_buffer(1, policy));
+                std::this_thread::sleep_for(std::chrono::seconds(2));
+                streams = profile.get_streams();
+                for (auto&& stream : streams)
+                    dropped += recorder.get_dropped_frames(stream);
+                REQUIRE_NOTHROW(p.stop());
+            }
+            if (policy == RS2_RECORD_OVERFLOW_BLOCK)
+                REQUIRE(dropped == 0);
+
+            // The sensors kept streaming, whatever was dropped
+            require_playback_frames(ctx, filename);
+        }
+    }
+}
+
+TEST_CASE("Recorder write buffer accounts for the bytes of queued frames", "[record-buffer]") {
+    const librealsense::device_serializer::stream_identifier depth{ 0, 0, RS2_STREAM_DEPTH, 0 };
+    auto buffer = std::make_shared<librealsense::record_write_buffer>(100);
+    REQUIRE(buffer->get_overflow_policy() == RS2_RECORD_OVERFLOW_STOP);
+
+    // A frame larger than the buffer is accepted into an empty buffer
+    auto large = buffer->reserve(depth, 150);
+    REQUIRE(large);
+    REQUIRE(buffer->get_buffered_bytes() == 150);
+    REQUIRE_FALSE(buffer->reserve(depth, 1));
+    large.reset();
+    REQUIRE(buffer->get_buffered_bytes() == 0);
+
+    auto first = buffer->reserve(depth, 60);
+    auto second = buffer->reserve(depth, 40);
+    REQUIRE(first);
+    REQUIRE(second);
+    REQUIRE(buffer->get_buffered_bytes() == 100);
+    first.reset();
+    REQUIRE(buffer->get_buffered_bytes() == 40);
+
+    // The size is back to the default with 0
+    buffer->set_size(20, RS2_RECORD_OVERFLOW_DROP);
+    REQUIRE_FALSE(buffer->reserve(depth, 1));
+    buffer->set_size(0, RS2_RECORD_OVERFLOW_DROP);
+    REQUIRE(buffer->reserve(depth, 60));
+    second.reset();
+    REQUIRE(buffer->get_buffered_bytes() == 0);
+}
+
+TEST_CASE("Recorder write buffer gives back the bytes of discarded frames", "[record-buffer]") {
+    const librealsense::device_serializer::stream_identifier depth{ 0, 0, RS2_STREAM_DEPTH, 0 };
+    auto buffer = std::make_shared<librealsense::record_write_buffer>(100);
+    {
+        dispatcher write_thread(10);
+        write_thread.start();
+        write_thread.invoke([](dispatcher::cancellable_timer t) { t.try_sleep(10000); });
+        auto reservation = buffer->reserve(depth, 60);
+        REQUIRE(reservation);
+        write_thread.invoke([reservation](dispatcher::cancellable_timer t) {});
+        reservation.reset();
+        REQUIRE(buffer->get_buffered_bytes() == 60);
+        // Stopping the thread discards the frames it did not write yet
+        write_thread.stop();
+        REQUIRE(buffer->get_buffered_bytes() == 0);
+
+        // So does queuing into a stopped thread
+        reservation = buffer->reserve(depth, 60);
+        write_thread.invoke([reservation](dispatcher::cancellable_timer t) {});
+        reservation.reset();
+        REQUIRE(buffer->get_buffered_bytes() == 0);
+    }
+}
+
+TEST_CASE("Recorder write buffer drops and counts the frames that overflow it", "[record-buffer]") {
+    const librealsense::device_serializer::stream_identifier depth{ 0, 0, RS2_STREAM_DEPTH, 0 };
+    const librealsense::device_serializer::stream_identifier infrared{ 0, 0, RS2_STREAM_INFRARED, 1 };
+    const librealsense::device_serializer::stream_identifier color{ 0, 1, RS2_STREAM_COLOR, 0 };
+    for (auto policy : { RS2_RECORD_OVERFLOW_STOP, RS2_RECORD_OVERFLOW_DROP })
+    {
+        CAPTURE(rs2_record_overflow_policy_to_string(policy));
+        auto buffer = std::make_shared<librealsense::record_write_buffer>(100);
+        buffer->set_size(100, policy);
+        REQUIRE(buffer->get_overflow_policy() == policy);
+
+        auto queued = buffer->reserve(color, 100);
+        REQUIRE(queued);
+        REQUIRE_FALSE(buffer->reserve(depth, 10));
+        REQUIRE_FALSE(buffer->reserve(depth, 10));
+        REQUIRE_FALSE(buffer->reserve(infrared, 10));
+        REQUIRE(buffer->get_dropped_frames(RS2_STREAM_DEPTH, 0) == 2);
+        REQUIRE(buffer->get_dropped_frames(RS2_STREAM_INFRARED, 1) == 1);
+        REQUIRE(buffer->get_dropped_frames(RS2_STREAM_INFRARED, 2) == 0);
+        REQUIRE(buffer->get_dropped_frames(RS2_STREAM_COLOR, 0) == 0);
+        REQUIRE(buffer->get_buffered_bytes() == 100);
+
+        // Frames fit again once the queued frames are written
+        queued.reset();
+        REQUIRE(buffer->reserve(depth, 10));
+        REQUIRE(buffer->get_dropped_frames(RS2_STREAM_DEPTH, 0) == 2);
+    }
+}
+
+TEST_CASE("Recorder write buffer holds the callbacks that overflow it", "[record-buffer]") {
+    const librealsense::device_serializer::stream_identifier depth{ 0, 0, RS2_STREAM_DEPTH, 0 };
+
+    SECTION("Until the queued frames are written")
+    {
+        auto buffer = std::make_shared<librealsense::record_write_buffer>(100);
+        buffer->set_size(100, RS2_RECORD_OVERFLOW_BLOCK);
+        auto queued = buffer->reserve(depth, 100);
+        REQUIRE(queued);
+        auto blocked = std::async(std::launch::async, [buffer, depth]() { return buffer->reserve(depth, 50); });
+        REQUIRE(blocked.wait_for(std::chrono::milliseconds(100)) == std::future_status::timeout);
+        queued.reset();
+        REQUIRE(blocked.wait_for(std::chrono::seconds(5)) == std::future_status::ready);
+        auto reservation = blocked.get();
+        REQUIRE(reservation);
+        REQUIRE(buffer->get_buffered_bytes() == 50);
+        REQUIRE(buffer->get_dropped_frames(RS2_STREAM_DEPTH, 0) == 0);
+    }
+
+    SECTION("Until the policy no longer allows it")
+    {
+        auto buffer = std::make_shared<librealsense::record_write_buffer>(100);
+        buffer->set_size(100, RS2_RECORD_OVERFLOW_BLOCK);
+        auto queued = buffer->reserve(depth, 100);
+        auto blocked = std::async(std::launch::async, [buffer, depth]() { return buffer->reserve(depth, 50); });
+        REQUIRE(blocked.wait_for(std::chrono::milliseconds(100)) == std::future_status::timeout);
+        buffer->set_size(100, RS2_RECORD_OVERFLOW_DROP);
+        REQUIRE(blocked.wait_for(std::chrono::seconds(5)) == std::future_status::ready);
+        REQUIRE_FALSE(blocked.get());
+        REQUIRE(buffer->get_dropped_frames(RS2_STREAM_DEPTH, 0) == 1);
+    }
+
+    SECTION("Until the buffer is stopped")
+    {
+        auto buffer = std::make_shared<librealsense::record_write_buffer>(100);
+        buffer->set_size(100, RS2_RECORD_OVERFLOW_BLOCK);
+        auto queued = buffer->reserve(depth, 100);
+        auto blocked = std::async(std::launch::async, [buffer, depth]() { return buffer->reserve(depth, 50); });
+        REQUIRE(blocked.wait_for(std::chrono::milliseconds(100)) == std::future_status::timeout);
+        buffer->stop();
+        REQUIRE(blocked.wait_for(std::chrono::seconds(5)) == std::future_status::ready);
+        REQUIRE_FALSE(blocked.get());
+        // Nothing is accepted once stopped, even into an empty buffer
+        queued.reset();
+        REQUIRE_FALSE(buffer->reserve(depth, 1));
+        REQUIRE(buffer->get_buffered_bytes() == 0);
+    }
+}
+
+TEST_CASE("Composite frames report the size of all their frames", "[record-buffer]") {
+    librealsense::frame_source source;
+    source.init(std::make_shared<librealsense::metadata_parser_map>());
+    librealsense::frame_additional_data data{};
+    librealsense::frame_holder first(source.alloc_frame(RS2_EXTENSION_VIDEO_FRAME, 100, data, true));
+    librealsense::frame_holder second(source.alloc_frame(RS2_EXTENSION_VIDEO_FRAME, 50, data, true));
+    librealsense::frame_holder composite(source.alloc_frame(RS2_EXTENSION_COMPOSITE_FRAME, 2 * sizeof(rs2_frame*), data, true));
+    REQUIRE(first);
+    REQUIRE(second);
+    REQUIRE(composite);
+    REQUIRE(first->get_frame_data_size() == 100);
+
+    auto frames = dynamic_cast<librealsense::composite_frame*>(composite.frame)->get_frames();
+    frames[0] = first.frame;
+    frames[1] = second.frame;
+    REQUIRE(composite->get_frame_data_size() == 150);
+    // The frames are released by their own holders
+    frames[0] = nullptr;
+    frames[1] = nullptr;
+}
+
+TEST_CASE("Random access to recorded frames", "[live]") {
+    rs2::context ctx;
+
+    if (make_context(SECTION_FROM_TEST_NAME, &ctx))
+    {
+        const std::string filename = get_folder_path(special_folder::temp_folder) + "test_random_access.bag";
+        record_to_file(ctx, filename, std::chrono::seconds(2));
+
+        auto playback = ctx.load_device(filename).as<rs2::playback>();
+        REQUIRE(playback);
+        for (auto&& sensor : playback.query_sensors())
+        {
+            for (auto&& stream : sensor.get_stream_profiles())
+            {
+                auto count = playback.get_frame_count(stream);
+                if (count == 0)
+                    continue;
+                CAPTURE(stream.stream_name());
+
+                // Frames read concurrently are the frames of the stream, in order
+                std::vector<unsigned long long> frame_numbers(count);
+                std::vector<std::thread> threads;
+                std::atomic<int> failures(0);
+                for (int t = 0; t < 4; t++)
+                {
+                    threads.emplace_back([&, t]()
+                    {
+                        try
+                        {
+                            for (auto i = static_cast<uint64_t>(t); i < count; i += 4)
+                            {
+                                auto f = playback.get_frame(stream, i);
+                                if (!f || f.get_profile().unique_id() != stream.unique_id())
+                                    failures++;
+                                frame_numbers[i] = f.get_frame_number();
+                            }
+                        }
+                        catch (...)
+                        {
+                            failures++;
+                        }
+                    });
+                }
+                for (auto&& thread : threads)
+                    thread.join();
+                REQUIRE(failures == 0);
+                REQUIRE(std::is_sorted(frame_numbers.begin(), frame_numbers.end()));
+
+                auto position = playback.find_frame_number(stream, frame_numbers[count / 2]);
+                REQUIRE(position <= count / 2);
+                REQUIRE(frame_numbers[position] == frame_numbers[count / 2]);
+                REQUIRE(playback.find_frame(stream, std::chrono::nanoseconds(0)) == 0);
+                REQUIRE(playback.get_frames(stream, std::chrono::nanoseconds(0), std::chrono::nanoseconds(playback.get_duration())).size() == count);
+                REQUIRE_THROWS(playback.get_frame(stream, count));
+            }
+        }
+    }
+}
+
+TEST_CASE("Offline processing of a recording", "[live]") {
+    rs2::context ctx;
+
+    if (make_context(SECTION_FROM_TEST_NAME, &ctx))
+    {
+        const std::string filename = get_folder_path(special_folder::temp_folder) + "test_offline_processing.bag";
+        record_to_file(ctx, filename, std::chrono::seconds(2));
+
+        auto playback = ctx.load_device(filename).as<rs2::playback>();
+        REQUIRE(playback);
+
+        // Depth paces the processing, the other recorded streams are attached to it
+        std::vector<rs2::stream_profile> streams;
+        for (auto&& sensor : playback.query_sensors())
+        {
+            for (auto&& stream : sensor.get_stream_profiles())
+            {
+                if (playback.get_frame_count(stream) == 0)
+                    continue;
+                if (stream.stream_type() == RS2_STREAM_DEPTH && stream.stream_index() == 0)
+                    streams.insert(streams.begin(), stream);
+                else if (stream.is<rs2::video_stream_profile>())
+                    streams.push_back(stream);
+            }
+        }
+        REQUIRE(!streams.empty());
+        REQUIRE(streams.front().stream_type() == RS2_STREAM_DEPTH);
+
+        auto count = playback.get_frame_count(streams.front());
+        std::vector<unsigned long long> expected;
+        for (uint64_t i = 0; i < count; i++)
+            expected.push_back(playback.get_frame(streams.front(), i).get_frame_number());
+
+        rs2::offline_processor processor(playback, streams, std::chrono::milliseconds(300), 4);
+        std::atomic<int> graphs(0);
+        std::vector<unsigned long long> outputs;
+        REQUIRE_NOTHROW(processor.process([&]()
+        {
+            graphs++;
+            auto colorizer = std::make_shared<rs2::colorizer>();
+            colorizer->set_option(RS2_OPTION_FRAMES_QUEUE_SIZE, 0);
+            return rs2::offline_processor::graph([colorizer](rs2::frame f)
+            {
+                auto fs = f.as<rs2::frameset>();
+                auto depth = fs ? fs.get_depth_frame() : f.as<rs2::depth_frame>();
+                return rs2::frame(colorizer->colorize(depth));
+            });
+        }, [&](rs2::frame f)
+        {
+            outputs.push_back(f.get_frame_number());
+        }));
+
+        REQUIRE(graphs > 1);
+        REQUIRE(outputs == expected);
+
+        // Errors of the processing graph reach the caller
+        REQUIRE_THROWS(processor.process([]()
+        {
+            return rs2::offline_processor::graph([](rs2::frame f) -> rs2::frame { throw std::runtime_error("graph failure"); });
+        }, [](rs2::frame) {}));
+    }
+}
+
 TEST_CASE("Syncer sanity with software-device device", "[live][software-device]") {
     rs2::context ctx;
     if (make_context(SECTION_FROM_TEST_NAME, &ctx))
@@ -4408,3 +4879,327 @@ TEST_CASE("C API Compilation", "[live]") {
     REQUIRE_NOTHROW(rs2_set_devices_changed_callback(NULL, dev_changed, NULL, &e));
     REQUIRE(e != nullptr);
 }
+
+TEST_CASE("Calibration cache serves and revalidates tables", "[calibration-cache]") {
+    std::string path = get_folder_path(special_folder::temp_folder) + "calibration_cache_test.bin";
+    std::remove(path.c_str());
+
+    std::vector<uint8_t> device_table{ 1, 2, 3, 4 };
+    std::atomic<int> reads(0);
+    auto read = [&]() { reads++; return device_table; };
+
+    // The first time the table is read from the device and cached
+    {
+        librealsense::calibration_cache cache(path);
+        REQUIRE(cache.get(25, read) == device_table);
+        REQUIRE(reads == 1);
+    }
+
+    // The next time the cached copy is returned, and compared with the device in the background
+    auto cached_table = device_table;
+    device_table = { 5, 6, 7 };
+    {
+        librealsense::calibration_cache cache(path);
+        REQUIRE(cache.get(25, read) == cached_table);
+        REQUIRE(cache.flush());
+        REQUIRE(reads == 2);
+        // Served from the cache, which the validation updated
+        REQUIRE(cache.get(25, read) == device_table);
+        REQUIRE(reads == 2);
+    }
+
+    // The table that changed on the device was rewritten to the cache
+    {
+        librealsense::calibration_cache cache(path);
+        REQUIRE(cache.get(25, read) == device_table);
+    }
+
+    // A corrupted cache is ignored
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file << "garbage";
+    }
+    {
+        librealsense::calibration_cache cache(path);
+        device_table = { 8 };
+        REQUIRE(cache.get(25, read) == device_table);
+    }
+    std::remove(path.c_str());
+}
+
+TEST_CASE("Batched motion frames number every sample", "[motion-batch]") {
+    const uint32_t samples = 3;
+    const size_t sample_size = 3 * sizeof(float);
+    librealsense::frame_source source;
+    source.init(std::make_shared<librealsense::metadata_parser_map>());
+    librealsense::frame_additional_data data{};
+    data.frame_number = 10;
+    data.motion_samples_count = samples;
+    librealsense::frame_holder f(source.alloc_frame(RS2_EXTENSION_MOTION_FRAME, librealsense::motion_frame::get_batch_size(samples, sample_size), data, true));
+    REQUIRE(f);
+
+    // Laid out as hid_sensor::publish_batch does: samples, timestamps, frame numbers
+    auto bytes = const_cast<uint8_t*>(f->get_frame_data());
+    rs2_time_t timestamps[samples] = { 1.0, 2.0, 3.0 };
+    unsigned long long frame_numbers[samples] = { 10, 11, 12 };
+    for (uint32_t i = 0; i < samples; i++)
+    {
+        float sample[3] = { float(i), float(i), float(i) };
+        memcpy(bytes + i * sample_size, sample, sample_size);
+    }
+    memcpy(bytes + samples * sample_size, timestamps, sizeof(timestamps));
+    memcpy(bytes + samples * (sample_size + sizeof(rs2_time_t)), frame_numbers, sizeof(frame_numbers));
+
+    auto motion = dynamic_cast<librealsense::motion_frame*>(f.frame);
+    REQUIRE(motion);
+    REQUIRE(motion->get_samples_count() == samples);
+    for (uint32_t i = 0; i < samples; i++)
+    {
+        REQUIRE(reinterpret_cast<const float*>(motion->get_sample_data(i))[0] == float(i));
+        REQUIRE(motion->get_sample_timestamp(i) == timestamps[i]);
+        REQUIRE(motion->get_sample_frame_number(i) == frame_numbers[i]);
+    }
+    REQUIRE_THROWS(motion->get_sample_frame_number(samples));
+}
+
+TEST_CASE("Filtered frames do not carry the DMABUF of their source", "[dmabuf]") {
+    const int W = 64;
+    const int H = 48;
+    const int BPP = 2;
+
+    software_device dev;
+    auto s = dev.add_sensor("software_sensor");
+    rs2_intrinsics intrinsics{ W, H, 0, 0, 0, 0, RS2_DISTORTION_NONE, { 0, 0, 0, 0, 0 } };
+    auto depth = s.add_video_stream({ RS2_STREAM_DEPTH, 0, 0, W, H, 30, BPP, RS2_FORMAT_Z16, intrinsics });
+    frame_queue q;
+    s.open(depth);
+    s.start(q);
+    std::vector<uint8_t> pixels(W * H * BPP, 0);
+    s.on_video_frame({ pixels.data(), [](void*) {}, W * BPP, BPP, 0, RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, 1, depth });
+    rs2::frame original;
+    REQUIRE(q.poll_for_frame(&original));
+
+    // As the V4L2 backend does when exporting its buffers
+    auto of = dynamic_cast<librealsense::frame*>((librealsense::frame_interface*)original.get());
+    REQUIRE(of);
+    of->additional_data.dmabuf_fd = 42;
+    of->additional_data.dmabuf_offset = 64;
+    REQUIRE(original.is<rs2::dmabuf_frame>());
+
+    hole_filling_filter filter;
+    auto result = filter.process(original);
+    REQUIRE(result);
+    REQUIRE(result.get() != original.get());
+    REQUIRE_FALSE(result.is<rs2::dmabuf_frame>());
+    auto rf = dynamic_cast<librealsense::video_frame*>((librealsense::frame_interface*)result.get());
+    REQUIRE(rf);
+    REQUIRE(rf->get_dmabuf_fd() == -1);
+    REQUIRE(rf->get_dmabuf_offset() == 0);
+
+    s.stop();
+    s.close();
+}
+
+TEST_CASE("RVL depth codec round trip", "[rvl]") {
+    const size_t width = 640, height = 480;
+    std::vector<uint16_t> depth(width * height);
+    for (size_t y = 0; y < height; y++)
+        for (size_t x = 0; x < width; x++)
+            depth[y * width + x] = ((x / 32 + y / 16) % 5 == 0) ? 0 : static_cast<uint16_t>(800 + x + (y * 7) % 13);
+    // Extreme deltas, and a trailing run of zeros
+    depth[1] = 65535;
+    depth[2] = 1;
+    std::fill(depth.end() - 100, depth.end(), static_cast<uint16_t>(0));
+
+    std::vector<uint8_t> encoded;
+    librealsense::rvl::encode(depth.data(), depth.size(), encoded);
+    REQUIRE(encoded.size() < depth.size() * sizeof(uint16_t) / 2);
+    REQUIRE(librealsense::rvl::decoded_size(encoded.data(), encoded.size()) == depth.size());
+
+    std::vector<uint16_t> decoded(depth.size());
+    librealsense::rvl::decode(encoded.data(), encoded.size(), decoded.data(), decoded.size());
+    REQUIRE(decoded == depth);
+
+    // Truncated and mismatching encodings are rejected
+    REQUIRE_THROWS(librealsense::rvl::decode(encoded.data(), encoded.size() / 2, decoded.data(), decoded.size()));
+    REQUIRE_THROWS(librealsense::rvl::decode(encoded.data(), encoded.size(), decoded.data(), decoded.size() - 1));
+
+    // Deltas that leave the 16 bit range are rejected
+    auto make_encoding = [](uint32_t pixels, std::vector<uint32_t> words)
+    {
+        std::vector<uint8_t> encoding(sizeof(pixels) + words.size() * sizeof(uint32_t));
+        memcpy(encoding.data(), &pixels, sizeof(pixels));
+        memcpy(encoding.data() + sizeof(pixels), words.data(), words.size() * sizeof(uint32_t));
+        return encoding;
+    };
+    std::vector<uint16_t> two(2);
+    // No zeros, 1 valid pixel of delta -1 (zigzag 1)
+    auto below = make_encoding(1, { 0x01100000 });
+    REQUIRE_THROWS(librealsense::rvl::decode(below.data(), below.size(), two.data(), 1));
+    // No zeros, 2 valid pixels of deltas 65535 (zigzag 131070) and 1 (zigzag 2)
+    auto above = make_encoding(2, { 0x02EFFFF3, 0x20000000 });
+    REQUIRE_THROWS(librealsense::rvl::decode(above.data(), above.size(), two.data(), 2));
+    // The same with a delta of 0 decodes
+    auto valid = make_encoding(2, { 0x02EFFFF3, 0x00000000 });
+    librealsense::rvl::decode(valid.data(), valid.size(), two.data(), 2);
+    REQUIRE(two == std::vector<uint16_t>({ 65535, 65535 }));
+}
+
+TEST_CASE("RVL depth codec gives up on images that do not compress", "[rvl]") {
+    // Noise, every pixel valid and far from the previous one
+    std::vector<uint16_t> noise(640 * 480);
+    uint32_t state = 1;
+    for (auto&& pixel : noise)
+    {
+        state = state * 1103515245 + 12345;
+        pixel = static_cast<uint16_t>((state >> 16) | 1);
+    }
+    auto raw_size = noise.size() * sizeof(uint16_t);
+
+    std::vector<uint8_t> encoded;
+    REQUIRE_FALSE(librealsense::rvl::encode(noise.data(), noise.size(), encoded, raw_size - 1));
+    REQUIRE(librealsense::rvl::encode(noise.data(), noise.size(), encoded));
+    REQUIRE(encoded.size() >= raw_size);
+
+    std::vector<uint16_t> decoded(noise.size());
+    librealsense::rvl::decode(encoded.data(), encoded.size(), decoded.data(), decoded.size());
+    REQUIRE(decoded == noise);
+}
+
+TEST_CASE("Playback read ahead keeps order and drops on seek", "[read-ahead]") {
+    using namespace librealsense::device_serializer;
+
+    // Serves frames with timestamps 0..count-1, and counts how many were read
+    class counting_reader : public reader
+    {
+    public:
+        std::atomic<int> position{ 0 };
+        const int count = 40;
+        std::string name = "counting";
+        std::mutex mutex;
+        std::condition_variable cv;
+
+        // Waits until at least n frames were read, or the timeout expires
+        bool wait_for_position(int n, std::chrono::milliseconds timeout)
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            return cv.wait_for(lock, timeout, [&]() { return position >= n; });
+        }
+
+        device_snapshot query_device_description(const nanoseconds& time) override { return device_snapshot(); }
+        std::shared_ptr<serialized_data> read_next_data() override
+        {
+            if (position >= count)
+                return std::make_shared<serialized_end_of_file>();
+            auto data = std::make_shared<serialized_frame>(nanoseconds(position), stream_identifier{ 0, 0, RS2_STREAM_DEPTH, 0 }, librealsense::frame_holder());
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                position++;
+            }
+            cv.notify_all();
+            return data;
+        }
+        void seek_to_time(const nanoseconds& time) override { position = static_cast<int>(time.count()); }
+        nanoseconds query_duration() const override { return nanoseconds(count); }
+        void reset() override { position = 0; }
+        void enable_stream(const std::vector<stream_identifier>& stream_ids) override {}
+        void disable_stream(const std::vector<stream_identifier>& stream_ids) override {}
+        const std::string& get_file_name() const override { return name; }
+        std::vector<std::shared_ptr<serialized_data>> fetch_last_frames(const nanoseconds& seek_time) override { return {}; }
+    };
+
+    auto inner = std::make_shared<counting_reader>();
+    librealsense::read_ahead_reader read_ahead(inner, 4, 1024);
+
+    // The reader is read ahead up to the limit, without anyone consuming the data
+    REQUIRE(inner->wait_for_position(4, std::chrono::seconds(5)));
+    REQUIRE(inner->position == 4);
+
+    // Each frame consumed makes room for a single frame more
+    REQUIRE(read_ahead.read_next_data()->get_timestamp().count() == 0);
+    REQUIRE(inner->wait_for_position(5, std::chrono::seconds(5)));
+    REQUIRE(inner->position == 5);
+
+    for (int i = 1; i < 10; i++)
+        REQUIRE(read_ahead.read_next_data()->get_timestamp().count() == i);
+
+    // Data read ahead of the seek is dropped
+    read_ahead.seek_to_time(nanoseconds(30));
+    REQUIRE(read_ahead.read_next_data()->get_timestamp().count() == 30);
+
+    // Without read ahead the data is read on the calling thread, still in order
+    read_ahead.set_limits(0, 0);
+    for (int i = 31; i < inner->count; i++)
+        REQUIRE(read_ahead.read_next_data()->get_timestamp().count() == i);
+    REQUIRE(read_ahead.read_next_data()->is<serialized_end_of_file>());
+    REQUIRE(read_ahead.read_next_data()->is<serialized_end_of_file>());
+    REQUIRE_THROWS(read_ahead.set_limits(librealsense::READ_AHEAD_MAX_FRAMES + 1, 0));
+
+    read_ahead.reset();
+    read_ahead.set_limits(2, 1024);
+    for (int i = 0; i < inner->count; i++)
+        REQUIRE(read_ahead.read_next_data()->get_timestamp().count() == i);
+    REQUIRE(read_ahead.read_next_data()->is<serialized_end_of_file>());
+}
+
+TEST_CASE("Frame index lookups and sidecar", "[frame-index]") {
+    using namespace librealsense::device_serializer;
+    stream_identifier depth{ 0, 0, RS2_STREAM_DEPTH, 0 };
+    stream_identifier color{ 0, 1, RS2_STREAM_COLOR, 0 };
+
+    librealsense::ros_frame_index index;
+    for (int i = 0; i < 100; i++)
+        index.add(depth, "/depth", nanoseconds(1000 + i * 33));
+    index.add(color, "/color", nanoseconds(5000));
+    REQUIRE(index.get_streams().size() == 2);
+    REQUIRE(index.get_topic(color) == "/color");
+    REQUIRE(index.get_frames(depth).size() == 100);
+
+    librealsense::ros_frame_index::entry frame;
+    REQUIRE_FALSE(index.find_at_or_before(depth, nanoseconds(999), frame));
+    REQUIRE(index.find_at_or_before(depth, nanoseconds(1000), frame));
+    REQUIRE(frame.time.count() == 1000);
+    REQUIRE(index.find_at_or_before(depth, nanoseconds(1000 + 50 * 33 + 10), frame));
+    REQUIRE(frame.time.count() == 1000 + 50 * 33);
+    REQUIRE(index.find_at_or_before(depth, nanoseconds::max(), frame));
+    REQUIRE(frame.time.count() == 1000 + 99 * 33);
+
+    // Frame numbers restart half way through the recording
+    REQUIRE_FALSE(index.has_frame_numbers(depth));
+    std::vector<uint64_t> numbers;
+    for (int i = 0; i < 100; i++)
+        numbers.push_back(10 + i % 50);
+    index.set_frame_numbers(depth, numbers);
+    size_t position = 0;
+    REQUIRE(index.find_frame_number(depth, 12, position));
+    REQUIRE(position == 2);
+    REQUIRE_FALSE(index.find_frame_number(depth, 9, position));
+    REQUIRE_FALSE(index.find_frame_number(color, 0, position));
+    REQUIRE(index.find_at_or_after(depth, nanoseconds(1001)) == 1);
+    REQUIRE(index.find_at_or_after(depth, nanoseconds(1000 + 99 * 33 + 1)) == 100);
+    REQUIRE_THROWS(index.set_frame_numbers(color, numbers));
+
+    // The sidecar restores the frame numbers of the same recording only
+    std::string path = get_folder_path(special_folder::temp_folder) + "frame_index_test.rsidx";
+    // Deleted at the end of the test, also when a check fails
+    struct file_remover
+    {
+        std::string path;
+        ~file_remover() { std::remove(path.c_str()); }
+    } remover{ path };
+    index.save_sidecar(path, 12345);
+
+    librealsense::ros_frame_index reopened;
+    for (auto&& e : index.get_frames(depth))
+        reopened.add(depth, "/depth", e.time);
+    reopened.add(color, "/color", nanoseconds(5000));
+    REQUIRE_FALSE(reopened.load_sidecar(path, 54321));
+    REQUIRE(reopened.load_sidecar(path, 12345));
+    REQUIRE(reopened.find_frame_number(depth, 59, position));
+    REQUIRE(position == 49);
+    REQUIRE_FALSE(reopened.has_frame_numbers(color));
+
+    librealsense::ros_frame_index other;
+    other.add(depth, "/depth", nanoseconds(1000));
+    REQUIRE_FALSE(other.load_sidecar(path, 12345));
+}
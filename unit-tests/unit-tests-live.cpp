@@ -1398,6 +1398,341 @@ TEST_CASE("Motion profiles sanity", "[live]")
     }
 }
 
+TEST_CASE("Batched motion frames carry timestamped samples", "[live]")
+{
+    rs2::context ctx;
+    if (make_context(SECTION_FROM_TEST_NAME, &ctx, "2.13.0"))
+    {
+        std::vector<sensor> list;
+        REQUIRE_NOTHROW(list = ctx.query_all_sensors());
+
+        for (auto&& s : list)
+        {
+            if (!s.supports(RS2_OPTION_MOTION_SAMPLES_BATCHING))
+                continue;
+
+            std::vector<rs2::stream_profile> gyro_profiles;
+            for (auto&& p : s.get_stream_profiles())
+                if (p.stream_type() == RS2_STREAM_GYRO && p.format() == RS2_FORMAT_MOTION_XYZ32F)
+                    gyro_profiles.push_back(p);
+            if (gyro_profiles.empty())
+                continue;
+
+            REQUIRE_NOTHROW(s.set_option(RS2_OPTION_MOTION_SAMPLES_BATCHING, 1));
+
+            std::mutex m;
+            std::vector<std::vector<double>> batches;
+            REQUIRE_NOTHROW(s.open(gyro_profiles.front()));
+            REQUIRE_NOTHROW(s.start([&](rs2::frame f)
+            {
+                auto motion = f.as<rs2::motion_frame>();
+                std::vector<double> timestamps;
+                for (size_t i = 0; i < motion.get_samples_count(); i++)
+                {
+                    motion.get_motion_data(i);
+                    timestamps.push_back(motion.get_sample_timestamp(i));
+                }
+                std::lock_guard<std::mutex> lock(m);
+                batches.push_back(timestamps);
+            }));
+            std::this_thread::sleep_for(std::chrono::seconds(1));
+            REQUIRE_NOTHROW(s.stop());
+            REQUIRE_NOTHROW(s.close());
+            REQUIRE_NOTHROW(s.set_option(RS2_OPTION_MOTION_SAMPLES_BATCHING, 0));
+
+            std::lock_guard<std::mutex> lock(m);
+            REQUIRE(batches.size() > 0);
+            for (auto&& timestamps : batches)
+            {
+                REQUIRE(timestamps.size() > 0);
+                REQUIRE(std::is_sorted(timestamps.begin(), timestamps.end()));
+            }
+        }
+    }
+}
+
+TEST_CASE("Adaptive frame buffers follow the consumer latency", "[live]")
+{
+    rs2::context ctx;
+    if (make_context(SECTION_FROM_TEST_NAME, &ctx, "2.13.0"))
+    {
+        std::vector<sensor> list;
+        REQUIRE_NOTHROW(list = ctx.query_all_sensors());
+
+        for (auto&& s : list)
+        {
+            if (!s.supports(RS2_OPTION_ADAPTIVE_FRAME_BUFFERS))
+                continue;
+
+            auto profiles = s.get_stream_profiles();
+            auto profile = std::find_if(profiles.begin(), profiles.end(), [](const rs2::stream_profile& p)
+            {
+                return p.is<rs2::video_stream_profile>() && p.fps() == 30;
+            });
+            if (profile == profiles.end())
+                continue;
+
+            REQUIRE_NOTHROW(s.set_option(RS2_OPTION_ADAPTIVE_FRAME_BUFFERS, 1));
+
+            // A consumer that holds every frame for about three frame times
+            REQUIRE_NOTHROW(s.open(*profile));
+            REQUIRE_NOTHROW(s.start([](rs2::frame f)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            }));
+            std::this_thread::sleep_for(std::chrono::seconds(2));
+            REQUIRE_NOTHROW(s.stop());
+            REQUIRE_NOTHROW(s.close());
+
+            // Backends that do not report capture statistics keep their own buffering
+            float first_buffers = 0;
+            REQUIRE_NOTHROW(first_buffers = s.get_option(RS2_OPTION_FRAME_BUFFERS));
+            if (first_buffers == 0)
+            {
+                REQUIRE_NOTHROW(s.set_option(RS2_OPTION_ADAPTIVE_FRAME_BUFFERS, 0));
+                continue;
+            }
+            REQUIRE(first_buffers == 4);
+
+            REQUIRE_NOTHROW(s.open(*profile));
+            REQUIRE_NOTHROW(s.start([](rs2::frame f) {}));
+            std::this_thread::sleep_for(std::chrono::milliseconds(500));
+            float buffers = 0;
+            REQUIRE_NOTHROW(buffers = s.get_option(RS2_OPTION_FRAME_BUFFERS));
+            REQUIRE(s.get_option(RS2_OPTION_DROPPED_FRAMES) >= 0);
+            REQUIRE_NOTHROW(s.stop());
+            REQUIRE_NOTHROW(s.close());
+            REQUIRE_NOTHROW(s.set_option(RS2_OPTION_ADAPTIVE_FRAME_BUFFERS, 0));
+
+            REQUIRE(buffers > first_buffers);
+            REQUIRE(buffers <= 16);
+        }
+    }
+}
+
+TEST_CASE("Exported DMABUF frames", "[live]")
+{
+    rs2::context ctx;
+    if (make_context(SECTION_FROM_TEST_NAME, &ctx, "2.13.0"))
+    {
+        std::vector<sensor> list;
+        REQUIRE_NOTHROW(list = ctx.query_all_sensors());
+
+        for (auto&& s : list)
+        {
+            if (!s.supports(RS2_OPTION_DMABUF_EXPORT))
+                continue;
+
+            // Z16 frames are delivered in the kernel buffers, without format conversion
+            auto profiles = s.get_stream_profiles();
+            auto profile = std::find_if(profiles.begin(), profiles.end(), [](const rs2::stream_profile& p)
+            {
+                return p.format() == RS2_FORMAT_Z16 && p.fps() == 30;
+            });
+            if (profile == profiles.end())
+                continue;
+
+            REQUIRE_NOTHROW(s.set_option(RS2_OPTION_DMABUF_EXPORT, 1));
+
+            std::mutex m;
+            std::vector<std::tuple<int, int, int, int>> exported; // fd, offset, stride, width
+            REQUIRE_NOTHROW(s.open(*profile));
+            REQUIRE_NOTHROW(s.start([&](rs2::frame f)
+            {
+                if (auto dmabuf = f.as<rs2::dmabuf_frame>())
+                {
+                    std::lock_guard<std::mutex> lock(m);
+                    exported.emplace_back(dmabuf.get_fd(), dmabuf.get_offset(), dmabuf.get_stride(), dmabuf.get_width());
+                }
+            }));
+            std::this_thread::sleep_for(std::chrono::seconds(1));
+            REQUIRE_NOTHROW(s.stop());
+            REQUIRE_NOTHROW(s.close());
+            REQUIRE_NOTHROW(s.set_option(RS2_OPTION_DMABUF_EXPORT, 0));
+
+            std::lock_guard<std::mutex> lock(m);
+            REQUIRE(exported.size() > 0);
+            for (auto&& e : exported)
+            {
+                REQUIRE(std::get<0>(e) >= 0);
+                REQUIRE(std::get<1>(e) >= 0);
+                REQUIRE(std::get<2>(e) >= std::get<3>(e) * 2);
+            }
+
+            // Without export the frames are plain video frames
+            REQUIRE_NOTHROW(s.open(*profile));
+            std::atomic<int> dmabuf_frames(0);
+            REQUIRE_NOTHROW(s.start([&](rs2::frame f)
+            {
+                if (f.is<rs2::dmabuf_frame>())
+                    dmabuf_frames++;
+            }));
+            std::this_thread::sleep_for(std::chrono::milliseconds(500));
+            REQUIRE_NOTHROW(s.stop());
+            REQUIRE_NOTHROW(s.close());
+            REQUIRE(dmabuf_frames == 0);
+        }
+    }
+}
+
+TEST_CASE("Stream statistics", "[live]")
+{
+    rs2::context ctx;
+    if (make_context(SECTION_FROM_TEST_NAME, &ctx, "2.13.0"))
+    {
+        std::vector<sensor> list;
+        REQUIRE_NOTHROW(list = ctx.query_all_sensors());
+
+        for (auto&& s : list)
+        {
+            auto profiles = s.get_stream_profiles();
+            auto profile = std::find_if(profiles.begin(), profiles.end(), [](const rs2::stream_profile& p)
+            {
+                return p.is<rs2::video_stream_profile>() && p.fps() == 30;
+            });
+            if (profile == profiles.end())
+                continue;
+
+            // A frame queue of one frame that is never read overflows on every frame after the first
+            rs2::frame_queue queue(1);
+            std::atomic<int> callbacks(0);
+            REQUIRE_NOTHROW(s.open(*profile));
+            REQUIRE_NOTHROW(s.start([&](rs2::frame f)
+            {
+                callbacks++;
+                queue.enqueue(f);
+            }));
+            std::this_thread::sleep_for(std::chrono::seconds(1));
+            REQUIRE_NOTHROW(s.stop());
+
+            rs2_stream_statistics statistics{};
+            REQUIRE_NOTHROW(statistics = s.get_stream_statistics(profile->stream_type(), profile->stream_index()));
+            REQUIRE(callbacks > 1);
+            REQUIRE(statistics.frames_received >= (unsigned long long)callbacks);
+            REQUIRE(statistics.queue_overflows == (unsigned long long)callbacks - 1);
+            REQUIRE(statistics.callback_duration.count == (unsigned long long)callbacks);
+
+            unsigned long long binned = 0;
+            for (auto count : statistics.callback_duration.bins)
+                binned += count;
+            REQUIRE(binned == statistics.callback_duration.count);
+            REQUIRE(statistics.callback_duration.max >= statistics.callback_duration.mean);
+
+            // Reopening the sensor starts counting again
+            REQUIRE_NOTHROW(s.close());
+            REQUIRE_NOTHROW(s.open(*profile));
+            REQUIRE_NOTHROW(statistics = s.get_stream_statistics(profile->stream_type(), profile->stream_index()));
+            REQUIRE(statistics.frames_received == 0);
+            REQUIRE(statistics.queue_overflows == 0);
+            REQUIRE_NOTHROW(s.close());
+        }
+    }
+}
+
+TEST_CASE("Cached options follow the values set", "[live]")
+{
+    rs2::context ctx;
+    if (make_context(SECTION_FROM_TEST_NAME, &ctx, "2.13.0"))
+    {
+        std::vector<sensor> list;
+        REQUIRE_NOTHROW(list = ctx.query_all_sensors());
+
+        for (auto&& s : list)
+        {
+            for (auto opt : { RS2_OPTION_BRIGHTNESS, RS2_OPTION_CONTRAST, RS2_OPTION_LASER_POWER })
+            {
+                if (!s.supports(opt))
+                    continue;
+
+                rs2::option_range range;
+                REQUIRE_NOTHROW(range = s.get_option_range(opt));
+                float initial = 0;
+                REQUIRE_NOTHROW(initial = s.get_option(opt));
+                // Repeated reads are served from the cache
+                REQUIRE(s.get_option(opt) == initial);
+
+                auto value = (initial == range.min) ? range.min + range.step : range.min;
+                REQUIRE_NOTHROW(s.set_option(opt, value));
+                REQUIRE(s.get_option(opt) == value);
+
+                REQUIRE_NOTHROW(s.set_option(opt, initial));
+                REQUIRE(s.get_option(opt) == initial);
+            }
+        }
+
+        // Controls written through the hw monitor by an advanced mode JSON load are read again
+        for (auto&& dev : ctx.query_devices())
+        {
+            if (!dev.is<rs400::advanced_mode>() || !dev.as<rs400::advanced_mode>().is_enabled())
+                continue;
+
+            auto advanced = dev.as<rs400::advanced_mode>();
+            for (auto&& s : dev.query_sensors())
+            {
+                if (!s.supports(RS2_OPTION_LASER_POWER))
+                    continue;
+
+                rs2::option_range range;
+                REQUIRE_NOTHROW(range = s.get_option_range(RS2_OPTION_LASER_POWER));
+                float initial = 0;
+                REQUIRE_NOTHROW(initial = s.get_option(RS2_OPTION_LASER_POWER));
+                auto value = (initial == range.min) ? range.min + range.step : range.min;
+
+                REQUIRE_NOTHROW(advanced.load_json("{ \"controls-laserpower\": " + std::to_string(value) + " }"));
+                REQUIRE(s.get_option(RS2_OPTION_LASER_POWER) == value);
+
+                REQUIRE_NOTHROW(advanced.load_json("{ \"controls-laserpower\": " + std::to_string(initial) + " }"));
+                REQUIRE(s.get_option(RS2_OPTION_LASER_POWER) == initial);
+            }
+        }
+    }
+}
+
+TEST_CASE("Kernel frame sequence and dequeue timestamp metadata", "[live]")
+{
+    rs2::context ctx;
+    if (make_context(SECTION_FROM_TEST_NAME, &ctx, "2.13.0"))
+    {
+        std::vector<sensor> list;
+        REQUIRE_NOTHROW(list = ctx.query_all_sensors());
+
+        for (auto&& s : list)
+        {
+            auto profiles = s.get_stream_profiles();
+            auto profile = std::find_if(profiles.begin(), profiles.end(), [](const rs2::stream_profile& p)
+            {
+                return p.is<rs2::video_stream_profile>() && p.fps() == 30;
+            });
+            if (profile == profiles.end())
+                continue;
+
+            std::mutex m;
+            std::vector<std::pair<rs2_metadata_type, rs2_metadata_type>> kernel_frames; // sequence, dequeue - backend time
+            REQUIRE_NOTHROW(s.open(*profile));
+            REQUIRE_NOTHROW(s.start([&](rs2::frame f)
+            {
+                // Reported only by backends that dequeue kernel buffers
+                if (!f.supports_frame_metadata(RS2_FRAME_METADATA_DEQUEUE_TIMESTAMP))
+                    return;
+
+                std::lock_guard<std::mutex> lock(m);
+                kernel_frames.emplace_back(f.get_frame_metadata(RS2_FRAME_METADATA_KERNEL_FRAME_SEQUENCE),
+                    f.get_frame_metadata(RS2_FRAME_METADATA_DEQUEUE_TIMESTAMP) - f.get_frame_metadata(RS2_FRAME_METADATA_BACKEND_TIMESTAMP));
+            }));
+            std::this_thread::sleep_for(std::chrono::seconds(1));
+            REQUIRE_NOTHROW(s.stop());
+            REQUIRE_NOTHROW(s.close());
+
+            std::lock_guard<std::mutex> lock(m);
+            for (size_t i = 1; i < kernel_frames.size(); i++)
+                REQUIRE(kernel_frames[i].first > kernel_frames[i - 1].first);
+            // The frame is dequeued after the kernel completed it, allowing for the clock conversion rounding
+            for (auto&& kernel_frame : kernel_frames)
+                REQUIRE(kernel_frame.second >= -1);
+        }
+    }
+}
+
 TEST_CASE("Check width and height of stream intrinsics", "[live][AdvMd]")
 {
     rs2::context ctx;
@@ -4190,6 +4525,64 @@ TEST_CASE("Pipeline - multicam scenario with specific devices", "[live][multicam
     }
 }
 
+TEST_CASE("Multi-device pipeline streams every device", "[live][multicam][pipeline][using_pipeline]") {
+    rs2::context ctx;
+
+    if (make_context(SECTION_FROM_TEST_NAME, &ctx, "2.13.0"))
+    {
+        std::set<std::string> serials;
+        for (auto&& dev : ctx.query_devices())
+        {
+            if (dev.supports(RS2_CAMERA_INFO_NAME) && std::string(dev.get_info(RS2_CAMERA_INFO_NAME)) != "Platform Camera")
+                serials.insert(dev.get_info(RS2_CAMERA_INFO_SERIAL_NUMBER));
+        }
+        if (serials.size() < 2)
+        {
+            WARN("Skipping test! This test requires multiple RealSense devices connected");
+            return;
+        }
+
+        rs2::multi_pipeline pipe(ctx);
+        rs2::config cfg;
+        cfg.enable_stream(RS2_STREAM_DEPTH);
+        std::vector<rs2::pipeline_profile> profiles;
+        REQUIRE_NOTHROW(profiles = pipe.start(cfg));
+        REQUIRE(profiles.size() == serials.size());
+
+        std::map<int, std::string> stream_to_serial;
+        for (auto&& profile : profiles)
+        {
+            std::string serial = profile.get_device().get_info(RS2_CAMERA_INFO_SERIAL_NUMBER);
+            for (auto&& stream : profile.get_streams())
+                stream_to_serial[stream.unique_id()] = serial;
+        }
+
+        // Every device should deliver its own framesets
+        std::set<std::string> streaming_serials;
+        for (int i = 0; i < 100 && streaming_serials.size() < serials.size(); i++)
+        {
+            rs2::frameset fs;
+            REQUIRE_NOTHROW(fs = pipe.wait_for_frames());
+            REQUIRE(fs.size() > 0);
+            REQUIRE(stream_to_serial.count(fs[0].get_profile().unique_id()) == 1);
+            streaming_serials.insert(stream_to_serial[fs[0].get_profile().unique_id()]);
+        }
+        REQUIRE(streaming_serials == serials);
+
+        // Once the queues of all the devices hold framesets, the devices are served in turn, whatever their frame rates
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        std::set<std::string> served_serials;
+        for (size_t i = 0; i < serials.size(); i++)
+        {
+            rs2::frameset fs;
+            REQUIRE(pipe.poll_for_frames(&fs));
+            served_serials.insert(stream_to_serial[fs[0].get_profile().unique_id()]);
+        }
+        REQUIRE(served_serials == serials);
+        REQUIRE_NOTHROW(pipe.stop());
+    }
+}
+
 TEST_CASE("Empty Pipeline Profile", "[live][pipeline][using_pipeline]") {
     rs2::context ctx;
 
@@ -4335,6 +4728,67 @@ TEST_CASE("Pipeline start after resolve uses the same profile", "[live][pipeline
     }
 }
 
+TEST_CASE("Pipeline restart with the same config uses the same profile", "[live][pipeline][using_pipeline]") {
+    rs2::context ctx;
+
+    if (make_context(SECTION_FROM_TEST_NAME, &ctx, "2.13.0"))
+    {
+        rs2::pipeline pipe(ctx);
+        rs2::config cfg;
+        cfg.enable_stream(RS2_STREAM_DEPTH);
+        rs2::pipeline_profile first_profile;
+        REQUIRE_NOTHROW(first_profile = pipe.start(cfg));
+        REQUIRE(first_profile);
+        REQUIRE_NOTHROW(pipe.wait_for_frames());
+        REQUIRE_NOTHROW(pipe.stop());
+
+        rs2::config same_cfg;
+        same_cfg.enable_stream(RS2_STREAM_DEPTH);
+        rs2::pipeline_profile second_profile;
+        REQUIRE_NOTHROW(second_profile = pipe.start(same_cfg));
+        REQUIRE(second_profile);
+        REQUIRE_NOTHROW(require_pipeline_profile_same(first_profile, second_profile));
+        REQUIRE_NOTHROW(pipe.wait_for_frames());
+        REQUIRE_NOTHROW(pipe.stop());
+    }
+}
+
+TEST_CASE("Pipeline bandwidth aware resolve does not raise frame rates", "[live][pipeline][using_pipeline]") {
+    rs2::context ctx;
+
+    if (make_context(SECTION_FROM_TEST_NAME, &ctx, "2.13.0"))
+    {
+        rs2::pipeline pipe(ctx);
+        rs2::config cfg;
+        rs2::pipeline_profile default_profile;
+        REQUIRE_NOTHROW(default_profile = cfg.resolve(pipe));
+        REQUIRE(default_profile);
+
+        rs2::config bandwidth_cfg;
+        bandwidth_cfg.enable_bandwidth_aware_resolve();
+        rs2::pipeline_profile bandwidth_profile;
+        REQUIRE_NOTHROW(bandwidth_profile = bandwidth_cfg.resolve(pipe));
+        REQUIRE(bandwidth_profile);
+
+        auto default_streams = default_profile.get_streams();
+        auto bandwidth_streams = bandwidth_profile.get_streams();
+        REQUIRE(default_streams.size() == bandwidth_streams.size());
+        for (auto&& s : bandwidth_streams)
+        {
+            auto it = std::find_if(default_streams.begin(), default_streams.end(), [&](const rs2::stream_profile& p)
+            {
+                return p.stream_type() == s.stream_type() && p.stream_index() == s.stream_index();
+            });
+            REQUIRE(it != default_streams.end());
+            REQUIRE(s.fps() <= it->fps());
+        }
+
+        REQUIRE_NOTHROW(pipe.start(bandwidth_cfg));
+        REQUIRE_NOTHROW(pipe.wait_for_frames());
+        REQUIRE_NOTHROW(pipe.stop());
+    }
+}
+
 TEST_CASE("Pipeline start ignores previous config if it was changed", "[live][pipeline][using_pipeline][!mayfail]") {
     rs2::context ctx;
     if (make_context(SECTION_FROM_TEST_NAME, &ctx, "2.13.0"))
@@ -163,6 +163,8 @@ namespace Intel.RealSense
         ManualWhiteBalance = 26,
         PowerLineFrequency = 27,
         LowLightCompensation = 28,
+        KernelFrameSequence = 29,
+        DequeueTimestamp = 30,
     }
 
     public enum Option
@@ -210,6 +212,11 @@ namespace Intel.RealSense
         StereoBaseline = 40,
         AutoExposureConvergeStep = 41,
         InterCamSyncMode = 42,
+        MotionSamplesBatching = 43,
+        AdaptiveFrameBuffers = 44,
+        FrameBuffers = 45,
+        DroppedFrames = 46,
+        DmabufExport = 47,
     }
 
     public enum Sr300VisualPreset
@@ -245,6 +252,13 @@ namespace Intel.RealSense
         Stopped = 3,
     }
 
+    public enum RecordCompression
+    {
+        None = 0,
+        Lz4 = 1,
+        Lz4RvlDepth = 2,
+    }
+
     public enum RecordingMode
     {
         BlankFrames = 0,
@@ -4545,6 +4545,36 @@ const option = {
    * <br>Equivalent to its uppercase counterpart.
    */
   option_inter_cam_sync_mode: 'inter-cam-sync-mode',
+  /**
+   * String literal of <code>'motion-samples-batching'. <br>Deliver all the motion samples of a
+   * single read as one batched motion frame, with a timestamp per sample.
+   * <br>Equivalent to its uppercase counterpart.
+   */
+  option_motion_samples_batching: 'motion-samples-batching',
+  /**
+   * String literal of <code>'adaptive-frame-buffers'. <br>Choose the number of kernel frame
+   * buffers on stream start from the buffer hold times and frame drops of the previous stream.
+   * <br>Equivalent to its uppercase counterpart.
+   */
+  option_adaptive_frame_buffers: 'adaptive-frame-buffers',
+  /**
+   * String literal of <code>'frame-buffers'. <br>Number of kernel frame buffers the stream was
+   * started with.
+   * <br>Equivalent to its uppercase counterpart.
+   */
+  option_frame_buffers: 'frame-buffers',
+  /**
+   * String literal of <code>'dropped-frames'. <br>Number of frames dropped by the kernel since the
+   * stream was started.
+   * <br>Equivalent to its uppercase counterpart.
+   */
+  option_dropped_frames: 'dropped-frames',
+  /**
+   * String literal of <code>'dmabuf-export'. <br>Export the frame buffers of the next stream as
+   * DMABUF file descriptors, see RS2_EXTENSION_DMABUF_FRAME.
+   * <br>Equivalent to its uppercase counterpart.
+   */
+  option_dmabuf_export: 'dmabuf-export',
   /**
    * Enable / disable color backlight compensatio.<br>Equivalent to its lowercase counterpart.
    * @type {Integer}
@@ -4791,6 +4821,39 @@ const option = {
    * @type {Integer}
    */
   OPTION_INTER_CAM_SYNC_MODE: RS2.RS2_OPTION_INTER_CAM_SYNC_MODE,
+  /**
+   * Deliver all the motion samples of a single read as one batched motion frame, with a
+   * timestamp per sample
+   * <br>Equivalent to its lowercase counterpart
+   * @type {Integer}
+   */
+  OPTION_MOTION_SAMPLES_BATCHING: RS2.RS2_OPTION_MOTION_SAMPLES_BATCHING,
+  /**
+   * Choose the number of kernel frame buffers on stream start from the buffer hold times and frame
+   * drops of the previous stream
+   * <br>Equivalent to its lowercase counterpart
+   * @type {Integer}
+   */
+  OPTION_ADAPTIVE_FRAME_BUFFERS: RS2.RS2_OPTION_ADAPTIVE_FRAME_BUFFERS,
+  /**
+   * Number of kernel frame buffers the stream was started with
+   * <br>Equivalent to its lowercase counterpart
+   * @type {Integer}
+   */
+  OPTION_FRAME_BUFFERS: RS2.RS2_OPTION_FRAME_BUFFERS,
+  /**
+   * Number of frames dropped by the kernel since the stream was started
+   * <br>Equivalent to its lowercase counterpart
+   * @type {Integer}
+   */
+  OPTION_DROPPED_FRAMES: RS2.RS2_OPTION_DROPPED_FRAMES,
+  /**
+   * Export the frame buffers of the next stream as DMABUF file descriptors, see
+   * RS2_EXTENSION_DMABUF_FRAME
+   * <br>Equivalent to its lowercase counterpart
+   * @type {Integer}
+   */
+  OPTION_DMABUF_EXPORT: RS2.RS2_OPTION_DMABUF_EXPORT,
   /**
    * Number of enumeration values. Not a valid input: intended to be used in for-loops.
    * @type {Integer}
@@ -4893,6 +4956,16 @@ const option = {
         return this.option_auto_exposure_converge_step;
       case this.OPTION_INTER_CAM_SYNC_MODE:
         return this.option_inter_cam_sync_mode;
+      case this.OPTION_MOTION_SAMPLES_BATCHING:
+        return this.option_motion_samples_batching;
+      case this.OPTION_ADAPTIVE_FRAME_BUFFERS:
+        return this.option_adaptive_frame_buffers;
+      case this.OPTION_FRAME_BUFFERS:
+        return this.option_frame_buffers;
+      case this.OPTION_DROPPED_FRAMES:
+        return this.option_dropped_frames;
+      case this.OPTION_DMABUF_EXPORT:
+        return this.option_dmabuf_export;
       default:
         throw new TypeError(
             'option.optionToString(option) expects a valid value as the 1st argument');
@@ -5210,6 +5283,17 @@ const frame_metadata = {
    * <br>Equivalent to its uppercase counterpart
    */
   frame_metadata_low_light_compensation: 'low-light-compensation',
+  /**
+   * Sequence number of the frame buffer in the kernel driver, gaps are frames dropped before
+   * reaching the library.
+   * <br>Equivalent to its uppercase counterpart
+   */
+  frame_metadata_kernel_frame_sequence: 'kernel-frame-sequence',
+  /**
+   * Time the library dequeued the frame from the kernel driver, in system clock.
+   * <br>Equivalent to its uppercase counterpart
+   */
+  frame_metadata_dequeue_timestamp: 'dequeue-timestamp',
   /**
    * A sequential index managed per-stream. Integer value <br>Equivalent to its lowercase
    * counterpart.
@@ -5385,6 +5469,19 @@ const frame_metadata = {
    * @type {Integer}
    */
   FRAME_METADATA_LOW_LIGHT_COMPENSATION: RS2.RS2_FRAME_METADATA_LOW_LIGHT_COMPENSATION,
+  /**
+   * Sequence number of the frame buffer in the kernel driver, gaps are frames dropped before
+   * reaching the library.
+   * <br>Equivalent to its lowercase counterpart
+   * @type {Integer}
+   */
+  FRAME_METADATA_KERNEL_FRAME_SEQUENCE: RS2.RS2_FRAME_METADATA_KERNEL_FRAME_SEQUENCE,
+  /**
+   * Time the library dequeued the frame from the kernel driver, in system clock.
+   * <br>Equivalent to its lowercase counterpart
+   * @type {Integer}
+   */
+  FRAME_METADATA_DEQUEUE_TIMESTAMP: RS2.RS2_FRAME_METADATA_DEQUEUE_TIMESTAMP,
   /**
    * Number of enumeration values. Not a valid input: intended to be used in for-loops.
    * @type {Integer}
@@ -5459,6 +5556,10 @@ const frame_metadata = {
         return this.frame_metadata_power_line_frequency;
       case this.FRAME_METADATA_LOW_LIGHT_COMPENSATION:
         return this.frame_metadata_low_light_compensation;
+      case this.FRAME_METADATA_KERNEL_FRAME_SEQUENCE:
+        return this.frame_metadata_kernel_frame_sequence;
+      case this.FRAME_METADATA_DEQUEUE_TIMESTAMP:
+        return this.frame_metadata_dequeue_timestamp;
     }
   },
 };
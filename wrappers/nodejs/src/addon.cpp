@@ -4628,6 +4628,8 @@ void InitModule(v8::Local<v8::Object> exports) {
   _FORCE_SET_ENUM(RS2_FRAME_METADATA_MANUAL_WHITE_BALANCE);
   _FORCE_SET_ENUM(RS2_FRAME_METADATA_POWER_LINE_FREQUENCY);
   _FORCE_SET_ENUM(RS2_FRAME_METADATA_LOW_LIGHT_COMPENSATION);
+  _FORCE_SET_ENUM(RS2_FRAME_METADATA_KERNEL_FRAME_SEQUENCE);
+  _FORCE_SET_ENUM(RS2_FRAME_METADATA_DEQUEUE_TIMESTAMP);
   _FORCE_SET_ENUM(RS2_FRAME_METADATA_COUNT);
 
   // rs2_distortion
@@ -4682,6 +4684,11 @@ void InitModule(v8::Local<v8::Object> exports) {
   _FORCE_SET_ENUM(RS2_OPTION_STEREO_BASELINE);
   _FORCE_SET_ENUM(RS2_OPTION_AUTO_EXPOSURE_CONVERGE_STEP);
   _FORCE_SET_ENUM(RS2_OPTION_INTER_CAM_SYNC_MODE);
+  _FORCE_SET_ENUM(RS2_OPTION_MOTION_SAMPLES_BATCHING);
+  _FORCE_SET_ENUM(RS2_OPTION_ADAPTIVE_FRAME_BUFFERS);
+  _FORCE_SET_ENUM(RS2_OPTION_FRAME_BUFFERS);
+  _FORCE_SET_ENUM(RS2_OPTION_DROPPED_FRAMES);
+  _FORCE_SET_ENUM(RS2_OPTION_DMABUF_EXPORT);
   _FORCE_SET_ENUM(RS2_OPTION_COUNT);
 
   // rs2_camera_info
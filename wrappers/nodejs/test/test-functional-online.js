@@ -427,6 +427,11 @@ describe('enum value test', function() {
       'OPTION_STEREO_BASELINE',
       'OPTION_AUTO_EXPOSURE_CONVERGE_STEP',
       'OPTION_INTER_CAM_SYNC_MODE',
+      'OPTION_MOTION_SAMPLES_BATCHING',
+      'OPTION_ADAPTIVE_FRAME_BUFFERS',
+      'OPTION_FRAME_BUFFERS',
+      'OPTION_DROPPED_FRAMES',
+      'OPTION_DMABUF_EXPORT',
     ];
     const strAttrs = [
       'option_backlight_compensation',
@@ -472,6 +477,11 @@ describe('enum value test', function() {
       'option_stereo_baseline',
       'option_auto_exposure_converge_step',
       'option_inter_cam_sync_mode',
+      'option_motion_samples_batching',
+      'option_adaptive_frame_buffers',
+      'option_frame_buffers',
+      'option_dropped_frames',
+      'option_dmabuf_export',
     ];
     numberAttrs.forEach((attr) => {
       assert.equal(typeof obj[attr], 'number');
@@ -143,6 +143,8 @@ PYBIND11_MODULE(NAME, m) {
     BIND_ENUM(m, rs2_timestamp_domain, RS2_TIMESTAMP_DOMAIN_COUNT)
     BIND_ENUM(m, rs2_distortion, RS2_DISTORTION_COUNT)
     BIND_ENUM(m, rs2_playback_status, RS2_PLAYBACK_STATUS_COUNT)
+    BIND_ENUM(m, rs2_record_compression, RS2_RECORD_COMPRESSION_COUNT)
+    BIND_ENUM(m, rs2_record_overflow_policy, RS2_RECORD_OVERFLOW_COUNT)
 
     py::class_<rs2_extrinsics> extrinsics(m, "extrinsics");
     extrinsics.def(py::init<>())
@@ -185,6 +187,23 @@ PYBIND11_MODULE(NAME, m) {
         .def_property(BIND_RAW_ARRAY_PROPERTY(rs2_motion_device_intrinsic, noise_variances, float, 3))
         .def_property(BIND_RAW_ARRAY_PROPERTY(rs2_motion_device_intrinsic, bias_variances, float, 3));
 
+    py::class_<rs2_latency_histogram> latency_histogram(m, "latency_histogram");
+    latency_histogram.def(py::init<>())
+        .def_property(BIND_RAW_ARRAY_PROPERTY(rs2_latency_histogram, bins, unsigned long long, RS2_LATENCY_HISTOGRAM_BINS))
+        .def_readwrite("count", &rs2_latency_histogram::count)
+        .def_readwrite("mean", &rs2_latency_histogram::mean)
+        .def_readwrite("max", &rs2_latency_histogram::max);
+
+    py::class_<rs2_stream_statistics> stream_statistics(m, "stream_statistics");
+    stream_statistics.def(py::init<>())
+        .def_readwrite("frames_received", &rs2_stream_statistics::frames_received)
+        .def_readwrite("kernel_drops", &rs2_stream_statistics::kernel_drops)
+        .def_readwrite("publish_failures", &rs2_stream_statistics::publish_failures)
+        .def_readwrite("queue_overflows", &rs2_stream_statistics::queue_overflows)
+        .def_readwrite("kernel_to_dequeue", &rs2_stream_statistics::kernel_to_dequeue)
+        .def_readwrite("dequeue_to_callback", &rs2_stream_statistics::dequeue_to_callback)
+        .def_readwrite("callback_duration", &rs2_stream_statistics::callback_duration);
+
     /* rs2_types.hpp */
 
     py::class_<rs2::option_range> option_range(m, "option_range");
@@ -356,7 +375,8 @@ PYBIND11_MODULE(NAME, m) {
          .def(BIND_DOWNCAST(frame, points))
          .def(BIND_DOWNCAST(frame, frameset))
          .def(BIND_DOWNCAST(frame, video_frame))
-         .def(BIND_DOWNCAST(frame, depth_frame));
+         .def(BIND_DOWNCAST(frame, depth_frame))
+         .def(BIND_DOWNCAST(frame, dmabuf_frame));
 
 
     py::class_<rs2::video_frame, rs2::frame> video_frame(m, "video_frame");
@@ -442,6 +462,12 @@ PYBIND11_MODULE(NAME, m) {
     depth_frame.def(py::init<rs2::frame>())
         .def("get_distance", &rs2::depth_frame::get_distance, "x"_a, "y"_a);
 
+    py::class_<rs2::dmabuf_frame, rs2::video_frame> dmabuf_frame(m, "dmabuf_frame");
+    dmabuf_frame.def(py::init<rs2::frame>())
+        .def("get_fd", &rs2::dmabuf_frame::get_fd, "DMABUF file descriptor of the frame, valid until the frame is released.")
+        .def("get_offset", &rs2::dmabuf_frame::get_offset, "Offset in bytes of the frame data in the DMABUF.")
+        .def("get_stride", &rs2::dmabuf_frame::get_stride, "Distance in bytes between the starts of two lines.");
+
 
 
 
@@ -542,14 +568,34 @@ PYBIND11_MODULE(NAME, m) {
         .def("seek", &rs2::playback::seek, "time"_a)
         .def("is_real_time", &rs2::playback::is_real_time)
         .def("set_real_time", &rs2::playback::set_real_time, "real_time"_a)
+        .def("set_read_ahead", &rs2::playback::set_read_ahead, "max_frames"_a, "max_bytes"_a)
+        .def("get_frame_count", &rs2::playback::get_frame_count, "profile"_a)
+        .def("get_frame", &rs2::playback::get_frame, "profile"_a, "position"_a)
+        .def("get_frame_time", &rs2::playback::get_frame_time, "profile"_a, "position"_a)
+        .def("find_frame", &rs2::playback::find_frame, "profile"_a, "time"_a)
+        .def("find_frame_number", &rs2::playback::find_frame_number, "profile"_a, "frame_number"_a)
+        .def("get_frames", &rs2::playback::get_frames, "profile"_a, "from"_a, "to"_a)
         .def("set_status_changed_callback", [](rs2::playback& self, std::function<void(rs2_playback_status)> callback)
     { self.set_status_changed_callback(callback); }, "callback"_a)
         .def("current_status", &rs2::playback::current_status);
 
+    py::class_<rs2::offline_processor> offline_processor(m, "offline_processor");
+    offline_processor.def(py::init<rs2::playback, std::vector<rs2::stream_profile>, std::chrono::nanoseconds, unsigned int>(),
+                          "file"_a, "streams"_a, "segment"_a = std::chrono::nanoseconds(std::chrono::seconds(2)), "threads"_a = 0)
+        .def("process", [](const rs2::offline_processor& self, std::function<rs2::offline_processor::graph()> make_graph, std::function<void(rs2::frame)> on_output)
+    { py::gil_scoped_release lock; self.process(make_graph, on_output); }, "make_graph"_a, "on_output"_a);
+
     py::class_<rs2::recorder, rs2::device> recorder(m, "recorder");
     recorder.def(py::init<const std::string&, rs2::device>())
+        .def(py::init<const std::string&, rs2::device, rs2_record_compression, unsigned int, unsigned int>(), "file"_a, "device"_a, "compression"_a,
+             "chunk_size"_a = 0, "compression_threads"_a = 0)
         .def("pause", &rs2::recorder::pause)
-        .def("resume", &rs2::recorder::resume);
+        .def("resume", &rs2::recorder::resume)
+        .def("set_rotation", &rs2::recorder::set_rotation, "max_bytes"_a, "max_duration"_a = std::chrono::nanoseconds(0))
+        .def("set_write_buffer", &rs2::recorder::set_write_buffer, "max_bytes"_a, "policy"_a = RS2_RECORD_OVERFLOW_STOP)
+        .def("get_dropped_frames", &rs2::recorder::get_dropped_frames, "profile"_a)
+        .def("get_buffered_bytes", &rs2::recorder::get_buffered_bytes)
+        .def("filename", &rs2::recorder::filename);
 
     /* rs2_sensor.hpp */
     py::class_<rs2::stream_profile> stream_profile(m, "stream_profile");
@@ -653,6 +699,8 @@ PYBIND11_MODULE(NAME, m) {
         .def("stop", [](const rs2::sensor& self) { py::gil_scoped_release lock; self.stop(); }, "Stop streaming.")
         .def("get_stream_profiles", &rs2::sensor::get_stream_profiles, "Check if physical sensor is supported.")
         .def_property_readonly("profiles", &rs2::sensor::get_stream_profiles, "Check if physical sensor is supported.")
+        .def("get_stream_statistics", &rs2::sensor::get_stream_statistics, "Retrieve the runtime statistics of a stream of the sensor, "
+            "accumulated since the sensor was last opened.", "stream"_a, "index"_a = 0)
         .def(py::init<>())
         .def("__nonzero__", &rs2::sensor::operator bool)
         .def(BIND_DOWNCAST(sensor, roi_sensor))
@@ -711,7 +759,11 @@ PYBIND11_MODULE(NAME, m) {
         .def("enable_all_streams", &rs2::config::enable_all_streams)
         .def("enable_device", &rs2::config::enable_device, "serial"_a)
         .def("enable_device_from_file", &rs2::config::enable_device_from_file, "file_name"_a, "repeat_playback"_a = true)
-        .def("enable_record_to_file", &rs2::config::enable_record_to_file, "file_name"_a)
+        .def("enable_record_to_file", (void (rs2::config::*)(const std::string&)) &rs2::config::enable_record_to_file, "file_name"_a)
+        .def("enable_record_to_file", (void (rs2::config::*)(const std::string&, rs2_record_compression, unsigned int, unsigned int)) &rs2::config::enable_record_to_file,
+             "file_name"_a, "compression"_a, "chunk_size"_a = 0, "compression_threads"_a = 0)
+        .def("enable_profile_cache", &rs2::config::enable_profile_cache, "file_name"_a)
+        .def("enable_bandwidth_aware_resolve", &rs2::config::enable_bandwidth_aware_resolve, "enable"_a = true)
         .def("disable_stream", &rs2::config::disable_stream, "stream"_a, "index"_a = -1)
         .def("disable_all_streams", &rs2::config::disable_all_streams)
         .def("resolve", [](rs2::config* c, pipeline_wrapper pw) -> rs2::pipeline_profile { return c->resolve(pw._ptr); })